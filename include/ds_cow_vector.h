@@ -0,0 +1,55 @@
+#ifndef _DS_COW_VECTOR_H
+#define _DS_COW_VECTOR_H
+
+#include <stddef.h>
+
+#include "ds_vector.h"
+
+// Chunked copy-on-write vector. One writer edits the CowVector and publishes
+// versions; any thread can take an immutable snapshot of the last published
+// version in O(1) and read it without locks. A write copies only the chunk it
+// touches, and chunks are freed once no version references them.
+
+typedef struct CowVector CowVector;
+
+typedef struct CowSnapshot CowSnapshot;
+
+/* ============================= Writer ============================ */
+
+CowVector *cv_create(size_t data_size, size_t chunk_elems);
+
+CowVector *cv_from_vector(Vector *vec, size_t chunk_elems);
+
+void cv_destroy(CowVector *cv);
+
+int cv_push_back(CowVector *cv, const void *data);
+
+int cv_append_n(CowVector *cv, const void *data, size_t count);
+
+int cv_pop_back(CowVector *cv);
+
+int cv_get(CowVector *cv, void *dest, size_t index);
+
+int cv_set(CowVector *cv, const void *data, size_t index);
+
+void *cv_at(CowVector *cv, size_t index);
+
+size_t cv_size(CowVector *cv);
+
+int cv_publish(CowVector *cv);
+
+/* ============================ Snapshots ========================== */
+
+CowSnapshot *cv_snapshot(CowVector *cv);
+
+void cs_release(CowSnapshot *snap);
+
+size_t cs_size(CowSnapshot *snap);
+
+const void *cs_at(CowSnapshot *snap, size_t index);
+
+int cs_get(CowSnapshot *snap, void *dest, size_t index);
+
+const void *cs_chunk(CowSnapshot *snap, size_t chunk, size_t *count);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef _DS_EXTERNAL_SORT_H
+#define _DS_EXTERNAL_SORT_H
+
+#include <stddef.h>
+
+#include "ds_vector.h"
+
+// External merge sort for fixed-size records that do not fit in memory.
+// Records are pushed in any order; full buffers are sorted and spilled to
+// temporary files as sorted runs (written by a background thread while the
+// next buffer fills), then merged with a loser tree on the way out.
+
+typedef struct ExtSorter ExtSorter;
+
+// Optional parameters for ext_create; zeroed fields keep the defaults
+typedef struct
+{
+    size_t      memory_budget;  // bytes for run buffers and merge buffers (default 64 MB)
+    size_t      io_buffer;      // read-ahead bytes per run while merging (default 1 MB)
+    const char  *temp_dir;      // directory for run files (default $TMPDIR or /tmp)
+} ExtSortOptions;
+
+ExtSorter *ext_create(size_t data_size, int (*cmp)(void *a, void *b), const ExtSortOptions *opts);
+
+void ext_destroy(ExtSorter *sorter);
+
+int ext_push(ExtSorter *sorter, const void *record);
+
+int ext_push_n(ExtSorter *sorter, const void *records, size_t count);
+
+int ext_push_vector(ExtSorter *sorter, Vector *vec);
+
+int ext_finish(ExtSorter *sorter);
+
+int ext_next(ExtSorter *sorter, void *dest);
+
+size_t ext_num_runs(ExtSorter *sorter);
+
+int ext_sort_file(const char *input_path, const char *output_path, size_t data_size,
+                  int (*cmp)(void *a, void *b), const ExtSortOptions *opts);
+
+#endif
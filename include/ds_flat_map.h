@@ -0,0 +1,40 @@
+#ifndef _DS_FLAT_MAP_H
+#define _DS_FLAT_MAP_H
+
+#include <stddef.h>
+
+// Ordered map kept as a sorted array of entries in a Vector. An entry is a
+// caller-defined record that starts with its key (a set is an entry holding
+// only the key). Lookups are binary searches; single inserts go to a small
+// unsorted tail that is merged into the sorted array when it fills.
+
+typedef struct FlatMap FlatMap;
+
+// Compares the keys at the start of two entries; lookups pass a bare key as b
+typedef int (*FlatMapCompare)(void *a, void *b);
+
+FlatMap *fm_create(size_t entry_size, FlatMapCompare cmp);
+
+void fm_destroy(FlatMap *map);
+
+int fm_insert(FlatMap *map, const void *entry);
+
+int fm_insert_bulk(FlatMap *map, const void *entries, size_t count);
+
+void *fm_find(FlatMap *map, const void *key);
+
+int fm_contains(FlatMap *map, const void *key);
+
+int fm_erase(FlatMap *map, const void *key);
+
+int fm_lower_bound(FlatMap *map, const void *key, size_t *index);
+
+void *fm_data(FlatMap *map, size_t *count);
+
+int fm_flush(FlatMap *map);
+
+size_t fm_size(FlatMap *map);
+
+int fm_clear(FlatMap *map);
+
+#endif
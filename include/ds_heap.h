@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include "ds_vector.h"
+
 typedef struct Heap Heap; 
 
 // pointer to user-built compare funciton
@@ -10,6 +12,11 @@ typedef struct Heap Heap;
 // output: 1 if arr[arg_1] larger; 0 if arr[arg_2] larger 
 typedef int (*CompareFunc)(const void *, int, int);
 
+// pointer-based compare function
+// args: pointers to two elements (a, b)
+// output: nonzero if a belongs above b; 0 otherwise
+typedef int (*ElemCompareFunc)(const void *, const void *);
+
 // Function for internal use
 int hp__insert_internal(Heap *heap, void *data);
 
@@ -17,6 +24,16 @@ int hp__insert_internal(Heap *heap, void *data);
 
 Heap *hp_init(size_t data_size, int heap_size, CompareFunc comp_func);
 
+Heap *hp_init_dary(size_t data_size, int heap_size, int arity, CompareFunc comp_func);
+
+Heap *hp_init_elem(size_t data_size, int heap_size, int arity, ElemCompareFunc elem_cmp);
+
+Heap *hp_build(size_t data_size, void *array, int num_elements, CompareFunc comp_func);
+
+Heap *hp_from_array(size_t data_size, const void *array, int num_elements, CompareFunc comp_func);
+
+Heap *hp_from_vector(Vector *vec, CompareFunc comp_func);
+
 void hp_destroy(Heap *heap);
 
 int hp_peek(Heap *heap, void *dest_ptr);
@@ -25,6 +42,14 @@ int hp_get_size(Heap *heap);
 
 int hp_remove_top(Heap *heap);
 
+int hp_pop(Heap *heap, void *dest_ptr);
+
+int hp_pushpop(Heap *heap, const void *data, void *dest_ptr);
+
+int hp_replace_top(Heap *heap, const void *data, void *dest_ptr);
+
+int hp_pop_n(Heap *heap, void *dest_ptr, int count);
+
 #define heap_insert(heap_ptr, data_type, data)  \
     hp__insert_internal(heap_ptr, &((data_type){(data)}))
 
@@ -0,0 +1,167 @@
+#ifndef _DS_HEAP_TYPED_H
+#define _DS_HEAP_TYPED_H
+
+#include <stdlib.h>
+#include <limits.h>
+
+// Type-specialized binary heap generated at compile time.
+//
+//     #define INT_LESS(a, b) ((a) < (b))
+//     DS_HEAP_DEFINE(IntHeap, int, INT_LESS)
+//
+// defines the type IntHeap and static inline functions IntHeap_create,
+// IntHeap_destroy, IntHeap_push, IntHeap_peek, IntHeap_pop, IntHeap_pushpop,
+// IntHeap_replace_top and IntHeap_size.
+// LESS(a, b) receives two elements of type T (lvalues) and is nonzero if a
+// belongs above b; it can be a macro or a function and is inlined either way.
+// Return codes follow Heap: 0 on success, -1 on failure or empty heap.
+
+#define DS_HEAP_DEFINE(name, T, LESS)                                           \
+                                                                                \
+typedef struct name                                                             \
+{                                                                               \
+    T      *data;                                                               \
+    int     size;                                                               \
+    int     capacity;                                                           \
+} name;                                                                         \
+                                                                                \
+static inline name *name##_create(int capacity)                                 \
+{                                                                               \
+    if(capacity <= 0)                                                           \
+        return NULL;                                                            \
+                                                                                \
+    name *heap = malloc(sizeof(name));                                          \
+    if(heap == NULL)                                                            \
+        return NULL;                                                            \
+                                                                                \
+    heap->data = malloc((size_t)capacity * sizeof(T));                          \
+    if(heap->data == NULL)                                                      \
+    {                                                                           \
+        free(heap);                                                             \
+        return NULL;                                                            \
+    }                                                                           \
+                                                                                \
+    heap->size = 0;                                                             \
+    heap->capacity = capacity;                                                  \
+    return heap;                                                                \
+}                                                                               \
+                                                                                \
+static inline void name##_destroy(name *heap)                                   \
+{                                                                               \
+    if(heap == NULL)                                                            \
+        return;                                                                 \
+                                                                                \
+    free(heap->data);                                                           \
+    free(heap);                                                                 \
+}                                                                               \
+                                                                                \
+/* Move parents down into the hole until value fits */                          \
+static inline void name##_sift_up_(name *heap, int hole, T value)               \
+{                                                                               \
+    while(hole > 0)                                                             \
+    {                                                                           \
+        int parent = (hole - 1) / 2;                                            \
+        if(!(LESS(value, heap->data[parent])))                                  \
+            break;                                                              \
+        heap->data[hole] = heap->data[parent];                                  \
+        hole = parent;                                                          \
+    }                                                                           \
+    heap->data[hole] = value;                                                   \
+}                                                                               \
+                                                                                \
+/* Move children up into the hole until value fits */                           \
+static inline void name##_sift_down_(name *heap, int hole, T value)             \
+{                                                                               \
+    for(;;)                                                                     \
+    {                                                                           \
+        int child = hole * 2 + 1;                                               \
+        if(child >= heap->size)                                                 \
+            break;                                                              \
+        if(child + 1 < heap->size && LESS(heap->data[child + 1], heap->data[child])) \
+            child++;                                                            \
+        if(!(LESS(heap->data[child], value)))                                   \
+            break;                                                              \
+        heap->data[hole] = heap->data[child];                                   \
+        hole = child;                                                           \
+    }                                                                           \
+    heap->data[hole] = value;                                                   \
+}                                                                               \
+                                                                                \
+static inline int name##_push(name *heap, T value)                              \
+{                                                                               \
+    if(heap == NULL)                                                            \
+        return -1;                                                              \
+                                                                                \
+    if(heap->size == heap->capacity)                                            \
+    {                                                                           \
+        if(heap->capacity > INT_MAX / 2)                                        \
+            return -1;                                                          \
+        T *temp = realloc(heap->data, (size_t)heap->capacity * 2 * sizeof(T));  \
+        if(temp == NULL)                                                        \
+            return -1;                                                          \
+        heap->data = temp;                                                      \
+        heap->capacity *= 2;                                                    \
+    }                                                                           \
+                                                                                \
+    name##_sift_up_(heap, heap->size++, value);                                 \
+    return 0;                                                                   \
+}                                                                               \
+                                                                                \
+static inline int name##_peek(name *heap, T *dest)                              \
+{                                                                               \
+    if(heap == NULL || heap->size == 0)                                         \
+        return -1;                                                              \
+                                                                                \
+    *dest = heap->data[0];                                                      \
+    return 0;                                                                   \
+}                                                                               \
+                                                                                \
+/* dest may be NULL to discard the top */                                       \
+static inline int name##_pop(name *heap, T *dest)                               \
+{                                                                               \
+    if(heap == NULL || heap->size == 0)                                         \
+        return -1;                                                              \
+                                                                                \
+    if(dest)                                                                    \
+        *dest = heap->data[0];                                                  \
+                                                                                \
+    heap->size--;                                                               \
+    if(heap->size > 0)                                                          \
+        name##_sift_down_(heap, 0, heap->data[heap->size]);                     \
+    return 0;                                                                   \
+}                                                                               \
+                                                                                \
+/* Push value and pop the top; value returns at once if it would be the top */    \
+static inline int name##_pushpop(name *heap, T value, T *dest)                  \
+{                                                                               \
+    if(heap == NULL || dest == NULL)                                            \
+        return -1;                                                              \
+                                                                                \
+    if(heap->size > 0 && LESS(heap->data[0], value))                            \
+    {                                                                           \
+        *dest = heap->data[0];                                                  \
+        name##_sift_down_(heap, 0, value);                                      \
+    }                                                                           \
+    else                                                                        \
+        *dest = value;                                                          \
+    return 0;                                                                   \
+}                                                                               \
+                                                                                \
+/* Pop the top (into dest unless NULL) and push value with a single sift */     \
+static inline int name##_replace_top(name *heap, T value, T *dest)              \
+{                                                                               \
+    if(heap == NULL || heap->size == 0)                                         \
+        return -1;                                                              \
+                                                                                \
+    if(dest)                                                                    \
+        *dest = heap->data[0];                                                  \
+    name##_sift_down_(heap, 0, value);                                          \
+    return 0;                                                                   \
+}                                                                               \
+                                                                                \
+static inline int name##_size(name *heap)                                       \
+{                                                                               \
+    return heap ? heap->size : -1;                                              \
+}
+
+#endif
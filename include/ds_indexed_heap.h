@@ -0,0 +1,41 @@
+#ifndef _DS_INDEXED_HEAP_H
+#define _DS_INDEXED_HEAP_H
+
+#include <stddef.h>
+
+#include "ds_heap.h"
+
+// Binary heap whose elements stay at fixed slots addressed by handles.
+// ih_insert returns a handle that stays valid until the element is popped or
+// removed; the handle can then be reused by a later insert. The heap itself
+// orders handles and keeps a handle-to-position map up to date while sifting,
+// so an element's priority can be changed or the element removed in O(log n).
+// Elements are ordered with the pointer-based ElemCompareFunc from ds_heap.h.
+
+typedef struct IndexedHeap IndexedHeap;
+
+IndexedHeap *ih_create(size_t data_size, size_t capacity, ElemCompareFunc cmp);
+
+void ih_destroy(IndexedHeap *heap);
+
+int ih_insert(IndexedHeap *heap, const void *data, size_t *handle);
+
+int ih_peek(IndexedHeap *heap, void *dest, size_t *handle);
+
+int ih_pop(IndexedHeap *heap, void *dest, size_t *handle);
+
+int ih_get(IndexedHeap *heap, size_t handle, void *dest);
+
+void *ih_at(IndexedHeap *heap, size_t handle);
+
+int ih_update_priority(IndexedHeap *heap, size_t handle, const void *data);
+
+int ih_remove(IndexedHeap *heap, size_t handle, void *dest);
+
+int ih_contains(IndexedHeap *heap, size_t handle);
+
+size_t ih_size(IndexedHeap *heap);
+
+int ih_clear(IndexedHeap *heap);
+
+#endif
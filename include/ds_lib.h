@@ -2,6 +2,14 @@
 #define DS_LIB_H
 
 #include "ds_vector.h"
+#include "ds_vector_simd.h"
+#include "ds_parallel.h"
+#include "ds_cow_vector.h"
+#include "ds_seg_vector.h"
+#include "ds_soa.h"
+#include "ds_flat_map.h"
+#include "ds_external_sort.h"
+#include "ds_packed_vector.h"
 #include "ds_singly_list.h"
 #include "ds_doubly_list.h"
 #include "ds_stack.h"
@@ -9,5 +17,9 @@
 #include "ds_tree.h"
 #include "ds_hashtable.h"
 #include "ds_heap.h"
+#include "ds_heap_typed.h"
+#include "ds_indexed_heap.h"
+#include "ds_pairing_heap.h"
+#include "ds_radix_heap.h"
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef _DS_PACKED_VECTOR_H
+#define _DS_PACKED_VECTOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ds_vector.h"
+
+// Compressed vectors of unsigned integers.
+// PackedVector stores every value in the same number of bits (1-64) with O(1)
+// random access. DeltaVector stores a non-decreasing sequence in blocks of 128:
+// each block keeps its first value and the bit-packed gaps to the next values.
+// Bulk decoding uses AVX2 when v_simd_level() allows it.
+
+typedef struct PackedVector PackedVector;
+
+typedef struct DeltaVector DeltaVector;
+
+/* ========================== Packed Vector ======================== */
+
+PackedVector *pv_create(unsigned bits, size_t capacity);
+
+PackedVector *pv_from_vector(Vector *vec, VecKeyType type);
+
+void pv_destroy(PackedVector *pv);
+
+int pv_push_back(PackedVector *pv, uint64_t value);
+
+int pv_get(PackedVector *pv, size_t index, uint64_t *value);
+
+int pv_set(PackedVector *pv, size_t index, uint64_t value);
+
+int pv_decode(PackedVector *pv, size_t start, size_t count, uint64_t *out);
+
+size_t pv_size(PackedVector *pv);
+
+unsigned pv_bits(PackedVector *pv);
+
+size_t pv_memory(PackedVector *pv);
+
+/* ========================== Delta Vector ========================= */
+
+DeltaVector *dv_create(void);
+
+DeltaVector *dv_from_vector(Vector *vec, VecKeyType type);
+
+void dv_destroy(DeltaVector *dv);
+
+int dv_push_back(DeltaVector *dv, uint64_t value);
+
+int dv_get(DeltaVector *dv, size_t index, uint64_t *value);
+
+int dv_decode(DeltaVector *dv, size_t start, size_t count, uint64_t *out);
+
+int dv_lower_bound(DeltaVector *dv, uint64_t value, size_t *index);
+
+size_t dv_size(DeltaVector *dv);
+
+size_t dv_memory(DeltaVector *dv);
+
+#endif
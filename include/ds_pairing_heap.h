@@ -0,0 +1,38 @@
+#ifndef _DS_PAIRING_HEAP_H
+#define _DS_PAIRING_HEAP_H
+
+#include <stddef.h>
+
+#include "ds_heap.h"
+
+// Meldable heap (pairing heap): O(1) push and meld, O(log n) amortized pop,
+// decrease-key and remove. Nodes are carved from slabs owned by the heap;
+// ph_meld links the two roots and splices the slab and free lists, so merging
+// heaps of any size takes constant time and node handles stay valid.
+// Elements are ordered with the pointer-based ElemCompareFunc from ds_heap.h.
+
+typedef struct PairingHeap PairingHeap;
+
+typedef struct PairingNode PairingNode;
+
+PairingHeap *ph_create(size_t data_size, ElemCompareFunc cmp);
+
+void ph_destroy(PairingHeap *heap);
+
+PairingNode *ph_push(PairingHeap *heap, const void *data);
+
+int ph_peek(PairingHeap *heap, void *dest);
+
+int ph_pop(PairingHeap *heap, void *dest);
+
+int ph_meld(PairingHeap *dest, PairingHeap *src);
+
+int ph_decrease_key(PairingHeap *heap, PairingNode *node, const void *data);
+
+int ph_remove(PairingHeap *heap, PairingNode *node, void *dest);
+
+void *ph_data(PairingNode *node);
+
+size_t ph_size(PairingHeap *heap);
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef _DS_PARALLEL_H
+#define _DS_PARALLEL_H
+
+#include <stddef.h>
+
+#include "ds_vector.h"
+
+typedef struct ThreadPool ThreadPool;
+
+// Per-element callbacks; ctx is passed through unchanged
+typedef void (*ParForEachFunc)(void *elem, void *ctx);
+typedef void (*ParMapFunc)(const void *in, void *out, void *ctx);
+typedef int  (*ParPredFunc)(const void *elem, void *ctx);
+
+// Associative combiner: acc = acc (+) elem
+typedef void (*ParCombineFunc)(void *acc, const void *elem, void *ctx);
+
+/* =========================== Thread Pool  ======================== */
+
+ThreadPool *tp_create(size_t nthreads);
+
+void tp_destroy(ThreadPool *pool);
+
+size_t tp_size(ThreadPool *pool);
+
+/* ============================ Raw Arrays ========================= */
+
+int par_for_each(ThreadPool *pool, void *arr, size_t n, size_t data_size, size_t grain,
+                 ParForEachFunc fn, void *ctx);
+
+int par_map(ThreadPool *pool, const void *src, size_t n, size_t src_size, void *dst, size_t dst_size,
+            size_t grain, ParMapFunc fn, void *ctx);
+
+int par_filter(ThreadPool *pool, const void *src, size_t n, size_t data_size, void *dst, size_t *count,
+               size_t grain, ParPredFunc pred, void *ctx);
+
+int par_reduce(ThreadPool *pool, const void *arr, size_t n, size_t data_size, size_t grain,
+               const void *identity, ParCombineFunc combine, void *ctx, void *result);
+
+int par_scan(ThreadPool *pool, const void *src, void *dst, size_t n, size_t data_size, size_t grain,
+             const void *identity, ParCombineFunc combine, void *ctx, int inclusive);
+
+/* ============================= Vectors =========================== */
+
+int v_par_for_each(ThreadPool *pool, Vector *vec, size_t grain, ParForEachFunc fn, void *ctx);
+
+int v_par_map(ThreadPool *pool, Vector *src, Vector *dst, size_t grain, ParMapFunc fn, void *ctx);
+
+int v_par_filter(ThreadPool *pool, Vector *src, Vector *dst, size_t grain, ParPredFunc pred, void *ctx);
+
+int v_par_reduce(ThreadPool *pool, Vector *vec, size_t grain, const void *identity,
+                 ParCombineFunc combine, void *ctx, void *result);
+
+int v_par_scan(ThreadPool *pool, Vector *src, Vector *dst, size_t grain, const void *identity,
+               ParCombineFunc combine, void *ctx, int inclusive);
+
+#endif
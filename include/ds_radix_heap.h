@@ -0,0 +1,32 @@
+#ifndef _DS_RADIX_HEAP_H
+#define _DS_RADIX_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Min-heap for unsigned integer keys that are extracted in non-decreasing
+// order (event simulation, Dijkstra with integer weights). Every pushed key
+// must be at least the last popped key. Entries sit in key_bits + 1 buckets
+// indexed by the highest bit in which the key differs from that last key, so
+// push is O(1) and pop is O(key_bits) amortized, with no key comparisons
+// beyond a scan of one bucket. Each key carries a fixed-size value.
+
+typedef struct RadixHeap RadixHeap;
+
+RadixHeap *rh_create(unsigned key_bits, size_t value_size);
+
+void rh_destroy(RadixHeap *heap);
+
+int rh_push(RadixHeap *heap, uint64_t key, const void *value);
+
+int rh_pop(RadixHeap *heap, uint64_t *key, void *value);
+
+int rh_peek(RadixHeap *heap, uint64_t *key, void *value);
+
+uint64_t rh_last_key(RadixHeap *heap);
+
+size_t rh_size(RadixHeap *heap);
+
+int rh_clear(RadixHeap *heap);
+
+#endif
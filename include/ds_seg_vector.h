@@ -0,0 +1,44 @@
+#ifndef _DS_SEG_VECTOR_H
+#define _DS_SEG_VECTOR_H
+
+#include <stddef.h>
+
+// Segmented vector: elements live in segments of geometrically growing size
+// (first, first, 2*first, 4*first, ...), so growing never moves an element and
+// pointers returned by sv_at stay valid until the element is removed.
+
+typedef struct SegVector SegVector;
+
+SegVector *sv_create(size_t first_segment, size_t data_size);
+
+void sv_destroy(SegVector *sv);
+
+int sv_push_back(SegVector *sv, void *data);
+
+void *sv_emplace_back(SegVector *sv);
+
+int sv_pop_back(SegVector *sv);
+
+int sv_top(SegVector *sv, void *dest);
+
+int sv_get(SegVector *sv, void *dest, size_t index);
+
+int sv_set(SegVector *sv, void *data, size_t index);
+
+void *sv_at(SegVector *sv, size_t index);
+
+void *sv_segment(SegVector *sv, size_t segment, size_t *count);
+
+size_t sv_size(SegVector *sv);
+
+size_t sv_capacity(SegVector *sv);
+
+int sv_empty(SegVector *sv);
+
+int sv_clear(SegVector *sv);
+
+int sv_reserve(SegVector *sv, size_t capacity);
+
+int sv_shrink_to_fit(SegVector *sv);
+
+#endif
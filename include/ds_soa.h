@@ -0,0 +1,45 @@
+#ifndef _DS_SOA_H
+#define _DS_SOA_H
+
+#include <stddef.h>
+
+// Structure-of-arrays record container. Records are described by a schema of
+// fields (offset and size inside the caller's struct); each field is stored in
+// its own contiguous, cache-line aligned column, so a scan over one field reads
+// only that field's bytes.
+
+typedef struct SoaVector SoaVector;
+
+typedef struct
+{
+    size_t  offset;     // offsetof(record, field)
+    size_t  size;       // sizeof the field
+} SoaField;
+
+#define SOA_FIELD(type, member) { offsetof(type, member), sizeof(((type *)0)->member) }
+
+SoaVector *soa_create(const SoaField *fields, size_t num_fields, size_t record_size, size_t capacity);
+
+void soa_destroy(SoaVector *soa);
+
+int soa_push_row(SoaVector *soa, const void *record);
+
+int soa_append_rows(SoaVector *soa, const void *records, size_t count);
+
+int soa_get_row(SoaVector *soa, void *record, size_t index);
+
+int soa_set_row(SoaVector *soa, const void *record, size_t index);
+
+void *soa_column(SoaVector *soa, size_t field, size_t *count);
+
+int soa_sort_by(SoaVector *soa, size_t field, int (*cmp)(void *a, void *b));
+
+size_t soa_size(SoaVector *soa);
+
+size_t soa_num_fields(SoaVector *soa);
+
+int soa_clear(SoaVector *soa);
+
+int soa_reserve(SoaVector *soa, size_t capacity);
+
+#endif
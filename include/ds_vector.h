@@ -5,8 +5,32 @@
 
 typedef struct Vector Vector; 
 
+typedef struct VecEytzinger VecEytzinger;
+
+// Type of a fixed-width numeric key embedded in each element (used by v_sort_radix)
+typedef enum
+{
+    V_KEY_U32,      // uint32_t
+    V_KEY_I32,      // int32_t
+    V_KEY_F32,      // float
+    V_KEY_U64,      // uint64_t
+    V_KEY_I64,      // int64_t
+    V_KEY_F64       // double
+} VecKeyType;
+
+// Optional creation parameters for vec_create_opts; zeroed fields keep the defaults 
+typedef struct
+{
+    double  growth_factor;  // capacity multiplier on growth, > 1.0 (default 2.0)
+    size_t  growth_chunk;   // grow by this many elements instead of by a factor
+    size_t  max_bytes;      // hard limit on the array size in bytes (0 = unlimited)
+    int     use_mmap;       // Linux: back the array with mmap/mremap and transparent huge pages
+} VecOptions;
+
 Vector *vec_create(size_t capacity, size_t data_size);
 
+Vector *vec_create_opts(size_t capacity, size_t data_size, const VecOptions *opts);
+
 void vec_destroy(Vector *vec);
 
 int v_push_back(Vector *vec, void *data);
@@ -17,22 +41,83 @@ int v_top(Vector *vec, void *data);
 
 int v_get(Vector *vec, void *dest, size_t index);
 
+/*
+ * Zero-copy access. Returned pointers stay valid until the next call that can
+ * reallocate the array (v_push_back, v_emplace_back, v_insert, v_append_n,
+ * v_insert_range, v_resize, v_reserve, v_set_size, v_shrink_to_fit) or move
+ * elements (v_insert, v_insert_range, v_erase, v_erase_range, v_swap_remove,
+ * v_remove_if, any sort). Pointers to elements past the new end are also
+ * invalidated by v_pop_back, v_erase, v_erase_range, v_swap_remove,
+ * v_remove_if, v_set_size and v_clear.
+ */
+void *v_at(Vector *vec, size_t index);
+
+void *v_back(Vector *vec);
+
+void *v_data(Vector *vec, size_t *size);
+
+void *v_emplace_back(Vector *vec);
+
 int v_set(Vector *vec, void *data, size_t index);
 
 int v_insert(Vector *vec, void *data, size_t index);
 
 int v_erase(Vector *vec, size_t index);
 
+int v_append_n(Vector *vec, const void *data, size_t count);
+
+int v_insert_range(Vector *vec, const void *data, size_t count, size_t index);
+
+int v_erase_range(Vector *vec, size_t index, size_t count);
+
+int v_swap_remove(Vector *vec, size_t index);
+
+int v_remove_if(Vector *vec, int(*pred)(void *elem));
+
 size_t v_size(Vector *vec);
 
 size_t v_capacity(Vector *vec);
 
+size_t v_data_size(Vector *vec);
+
 int v_empty(Vector *vec);
 
 int v_clear(Vector *vec);
 
 int v_resize(Vector *vec, size_t new_capacity);
 
+int v_reserve(Vector *vec, size_t capacity);
+
+int v_set_size(Vector *vec, size_t size);
+
+int v_shrink_to_fit(Vector *vec);
+
 int v_sort(Vector *vec, int(*cmp)(void *a, void *b));
 
+int v_stable_sort(Vector *vec, int(*cmp)(void *a, void *b));
+
+int v_argsort(Vector *vec, int(*cmp)(void *a, void *b), size_t *indices, int apply);
+
+int v_sort_parallel(Vector *vec, int(*cmp)(void *a, void *b), size_t nthreads);
+
+int v_sort_radix(Vector *vec, size_t key_offset, VecKeyType key_type);
+
+int v_nth_element(Vector *vec, size_t nth, int(*cmp)(void *a, void *b));
+
+int v_partial_sort(Vector *vec, size_t k, int(*cmp)(void *a, void *b));
+
+int v_top_k(Vector *vec, size_t k, int(*cmp)(void *a, void *b), void *dest);
+
+int v_lower_bound(Vector *vec, const void *key, int(*cmp)(void *a, void *b), size_t *index);
+
+int v_upper_bound(Vector *vec, const void *key, int(*cmp)(void *a, void *b), size_t *index);
+
+int v_equal_range(Vector *vec, const void *key, int(*cmp)(void *a, void *b), size_t *first, size_t *last);
+
+VecEytzinger *v_eytzinger_build(Vector *vec, size_t key_offset, VecKeyType key_type);
+
+void v_eytzinger_destroy(VecEytzinger *ez);
+
+int v_eytzinger_lower_bound(VecEytzinger *ez, const void *key, size_t *index);
+
 #endif
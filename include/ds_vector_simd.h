@@ -0,0 +1,46 @@
+#ifndef _DS_VECTOR_SIMD_H
+#define _DS_VECTOR_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ds_vector.h"
+
+// Typed search and reduction kernels for Vectors of int32_t, int64_t, float and double.
+// The element type is given as V_KEY_I32, V_KEY_I64, V_KEY_F32 or V_KEY_F64 and must
+// match the vector's data_size. Kernels use the widest of SSE4.2/AVX2/AVX-512 the CPU
+// supports, chosen at runtime, with a portable scalar fallback.
+
+typedef enum
+{
+    V_CMP_EQ,
+    V_CMP_NE,
+    V_CMP_LT,
+    V_CMP_LE,
+    V_CMP_GT,
+    V_CMP_GE
+} VecCmpOp;
+
+typedef enum
+{
+    V_SIMD_SCALAR,
+    V_SIMD_SSE42,
+    V_SIMD_AVX2,
+    V_SIMD_AVX512
+} VecSimdLevel;
+
+int v_find_value(Vector *vec, VecKeyType type, const void *value, size_t *index);
+
+int v_count_value(Vector *vec, VecKeyType type, const void *value, size_t *count);
+
+int v_min_max(Vector *vec, VecKeyType type, size_t *min_index, size_t *max_index);
+
+int v_sum(Vector *vec, VecKeyType type, void *result);
+
+int v_compare_mask(Vector *vec, VecKeyType type, VecCmpOp op, const void *value, uint64_t *mask);
+
+VecSimdLevel v_simd_level(void);
+
+VecSimdLevel v_simd_set_level(VecSimdLevel max_level);
+
+#endif
@@ -0,0 +1,445 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sched.h>
+
+#include "../include/ds_cow_vector.h"
+
+// Default chunk size in bytes when the caller passes chunk_elems == 0
+#define CV_DEFAULT_CHUNK_BYTES 16384
+
+typedef struct CowChunk
+{
+    atomic_size_t   refs;           // number of versions (tables) that reference this chunk
+    uint8_t         data[];
+} CowChunk;
+
+// A version of the vector: the chunk table plus everything needed to read it
+// once the CowVector is gone. Snapshots are handles to a table.
+typedef struct CowSnapshot
+{
+    atomic_size_t   refs;           // writer's current version, the published slot and snapshots
+    size_t          data_size;
+    size_t          chunk_shift;    // chunk_elems == 1 << chunk_shift
+    size_t          num_elements;
+    size_t          num_chunks;
+    size_t          table_capacity;
+    CowChunk        *chunks[];
+} CowSnapshot;
+
+typedef struct CowVector
+{
+    size_t                  data_size;
+    size_t                  chunk_shift;
+    CowSnapshot             *current;   // version being edited; shared while refs > 1
+    _Atomic(CowSnapshot *)  published;  // version handed out by cv_snapshot
+    atomic_size_t           epoch;      // bumped by every cv_publish
+    atomic_size_t           acquiring[2]; // readers between loading published and taking a ref, by epoch parity
+} CowVector;
+
+// ======================= Helper Functions ===========================
+
+static size_t chunk_elems(const CowSnapshot *t)
+{
+    return (size_t)1 << t->chunk_shift;
+}
+
+static CowSnapshot *table_alloc(const CowVector *cv, size_t table_capacity)
+{
+    CowSnapshot *t = malloc(sizeof(CowSnapshot) + table_capacity * sizeof(CowChunk *));
+    if(!t)
+        return NULL;
+
+    atomic_init(&t->refs, 1);
+    t->data_size = cv->data_size;
+    t->chunk_shift = cv->chunk_shift;
+    t->num_elements = 0;
+    t->num_chunks = 0;
+    t->table_capacity = table_capacity;
+
+    return t;
+}
+
+static CowChunk *chunk_alloc(const CowSnapshot *t)
+{
+    CowChunk *c = malloc(sizeof(CowChunk) + (chunk_elems(t) * t->data_size));
+    if(!c)
+        return NULL;
+
+    atomic_init(&c->refs, 1);
+
+    return c;
+}
+
+static void chunk_release(CowChunk *c)
+{
+    if(atomic_fetch_sub_explicit(&c->refs, 1, memory_order_acq_rel) == 1)
+        free(c);
+}
+
+static void table_release(CowSnapshot *t)
+{
+    if(atomic_fetch_sub_explicit(&t->refs, 1, memory_order_acq_rel) == 1)
+    {
+        for(size_t i = 0; i < t->num_chunks; i++)
+            chunk_release(t->chunks[i]);
+        free(t);
+    }
+}
+
+// Make cv->current private to the writer, copying the chunk table (not the chunks) if shared
+static int own_table(CowVector *cv, size_t min_chunks)
+{
+    CowSnapshot *t = cv->current;
+    int shared = atomic_load_explicit(&t->refs, memory_order_acquire) > 1;
+
+    if(!shared && min_chunks <= t->table_capacity)
+        return 0;
+
+    size_t capacity = t->table_capacity ? t->table_capacity : 1;
+    while(capacity < min_chunks)
+        capacity = capacity > SIZE_MAX / 2 ? min_chunks : capacity * 2;
+
+    if(capacity > (SIZE_MAX - sizeof(CowSnapshot)) / sizeof(CowChunk *))
+        return -2; // Size overflow
+
+    if(!shared)
+    {
+        CowSnapshot *grown = realloc(t, sizeof(CowSnapshot) + capacity * sizeof(CowChunk *));
+        if(!grown)
+            return -2; // Allocation failed
+
+        grown->table_capacity = capacity;
+        cv->current = grown;
+        return 0;
+    }
+
+    CowSnapshot *copy = table_alloc(cv, capacity);
+    if(!copy)
+        return -2; // Allocation failed
+
+    copy->num_elements = t->num_elements;
+    copy->num_chunks = t->num_chunks;
+    for(size_t i = 0; i < t->num_chunks; i++)
+    {
+        copy->chunks[i] = t->chunks[i];
+        atomic_fetch_add_explicit(&copy->chunks[i]->refs, 1, memory_order_relaxed);
+    }
+
+    // Other holders keep the old version alive
+    table_release(t);
+    cv->current = copy;
+
+    return 0;
+}
+
+// Return a writable chunk of cv->current, copying it first if another version shares it
+static CowChunk *own_chunk(CowVector *cv, size_t chunk)
+{
+    if(own_table(cv, cv->current->num_chunks))
+        return NULL;
+
+    CowSnapshot *t = cv->current;
+    CowChunk *c = t->chunks[chunk];
+
+    if(atomic_load_explicit(&c->refs, memory_order_acquire) == 1)
+        return c;
+
+    CowChunk *copy = chunk_alloc(t);
+    if(!copy)
+        return NULL;
+
+    memcpy(copy->data, c->data, chunk_elems(t) * t->data_size);
+    t->chunks[chunk] = copy;
+    chunk_release(c);
+
+    return copy;
+}
+
+// ======================= Writer ===========================
+
+CowVector *cv_create(size_t data_size, size_t chunk_elems)
+{
+    if(data_size == 0)
+        return NULL;
+
+    if(chunk_elems == 0)
+        chunk_elems = CV_DEFAULT_CHUNK_BYTES / data_size;
+
+    CowVector *cv = malloc(sizeof(CowVector));
+    if(!cv)
+        return NULL;
+
+    // Round the chunk up to a power of two so indexing is a shift and a mask
+    cv->data_size = data_size;
+    cv->chunk_shift = 0;
+    while(((size_t)1 << cv->chunk_shift) < chunk_elems)
+        cv->chunk_shift++;
+
+    cv->current = table_alloc(cv, 4);
+    if(!cv->current)
+    {
+        free(cv);
+        return NULL;
+    }
+
+    // The empty vector is the first published version
+    atomic_fetch_add(&cv->current->refs, 1);
+    atomic_init(&cv->published, cv->current);
+    atomic_init(&cv->epoch, 0);
+    atomic_init(&cv->acquiring[0], 0);
+    atomic_init(&cv->acquiring[1], 0);
+
+    return cv;
+}
+
+CowVector *cv_from_vector(Vector *vec, size_t chunk_elems)
+{
+    if(!vec)
+        return NULL;
+
+    size_t n;
+    void *data = v_data(vec, &n);
+
+    CowVector *cv = cv_create(v_data_size(vec), chunk_elems);
+    if(!cv)
+        return NULL;
+
+    if(cv_append_n(cv, data, n) || cv_publish(cv))
+    {
+        cv_destroy(cv);
+        return NULL;
+    }
+
+    return cv;
+}
+
+void cv_destroy(CowVector *cv)
+{
+    if(!cv)
+        return;
+
+    // Outstanding snapshots keep their versions alive
+    table_release(atomic_load(&cv->published));
+    table_release(cv->current);
+    free(cv);
+}
+
+int cv_append_n(CowVector *cv, const void *data, size_t count)
+{
+    if(!cv || (!data && count > 0))
+        return -1; // Invalid input
+
+    if(count == 0)
+        return 0;
+
+    size_t per_chunk = (size_t)1 << cv->chunk_shift;
+    size_t total = cv->current->num_elements + count;
+    if(total < count || total > SIZE_MAX - per_chunk + 1)
+        return -2; // Size overflow
+
+    if(own_table(cv, (total + per_chunk - 1) >> cv->chunk_shift))
+        return -2; // Allocation failed
+
+    const uint8_t *src = data;
+    while(count > 0)
+    {
+        CowSnapshot *t = cv->current;
+        size_t chunk = t->num_elements >> cv->chunk_shift;
+        size_t offset = t->num_elements & (per_chunk - 1);
+        CowChunk *c;
+
+        if(chunk == t->num_chunks)
+        {
+            c = chunk_alloc(t);
+            if(!c)
+                return -2; // Allocation failed
+            t->chunks[t->num_chunks++] = c;
+        }
+        else
+        {
+            c = own_chunk(cv, chunk);
+            if(!c)
+                return -2; // Allocation failed
+            t = cv->current;
+        }
+
+        size_t n = per_chunk - offset < count ? per_chunk - offset : count;
+        memcpy(c->data + (offset * t->data_size), src, n * t->data_size);
+
+        t->num_elements += n;
+        src += n * t->data_size;
+        count -= n;
+    }
+
+    return 0;
+}
+
+int cv_push_back(CowVector *cv, const void *data)
+{
+    if(!cv || !data)
+        return -1; // Invalid input
+
+    return cv_append_n(cv, data, 1);
+}
+
+int cv_pop_back(CowVector *cv)
+{
+    if(!cv)
+        return -1; // Invalid input
+
+    if(cv->current->num_elements == 0)
+        return 1; // Empty
+
+    if(own_table(cv, cv->current->num_chunks))
+        return -2; // Allocation failed
+
+    CowSnapshot *t = cv->current;
+    t->num_elements--;
+
+    // Drop the last chunk once it holds nothing
+    if((t->num_elements & (chunk_elems(t) - 1)) == 0)
+        chunk_release(t->chunks[--t->num_chunks]);
+
+    return 0;
+}
+
+int cv_get(CowVector *cv, void *dest, size_t index)
+{
+    if(!cv || !dest)
+        return -1; // Invalid input
+
+    return cs_get(cv->current, dest, index);
+}
+
+void *cv_at(CowVector *cv, size_t index)
+{
+    if(!cv || index >= cv->current->num_elements)
+        return NULL;
+
+    CowChunk *c = own_chunk(cv, index >> cv->chunk_shift);
+    if(!c)
+        return NULL;
+
+    return c->data + ((index & (((size_t)1 << cv->chunk_shift) - 1)) * cv->data_size);
+}
+
+int cv_set(CowVector *cv, const void *data, size_t index)
+{
+    if(!cv || !data)
+        return -1; // Invalid input
+
+    if(index >= cv->current->num_elements)
+        return -2; // Out of bounds
+
+    void *slot = cv_at(cv, index);
+    if(!slot)
+        return -2; // Allocation failed
+
+    memcpy(slot, data, cv->data_size);
+
+    return 0;
+}
+
+size_t cv_size(CowVector *cv)
+{
+    return cv ? cv->current->num_elements : 0;
+}
+
+int cv_publish(CowVector *cv)
+{
+    if(!cv)
+        return -1; // Invalid input
+
+    // The published slot shares the current version; the next write copies on demand
+    atomic_fetch_add(&cv->current->refs, 1);
+    CowSnapshot *old = atomic_exchange(&cv->published, cv->current);
+
+    // Readers that may have loaded the old pointer registered under the old epoch.
+    // New readers count under the next one, so only the few already inside
+    // cv_snapshot are waited for, however many keep arriving
+    size_t epoch = atomic_fetch_add(&cv->epoch, 1);
+    while(atomic_load(&cv->acquiring[epoch & 1]) != 0)
+        sched_yield();
+
+    table_release(old);
+
+    return 0;
+}
+
+// ======================= Snapshots ===========================
+
+CowSnapshot *cv_snapshot(CowVector *cv)
+{
+    if(!cv)
+        return NULL;
+
+    // Register under the current epoch. If a publish moved the epoch on meanwhile,
+    // the next publish would not wait for this slot, so register again
+    atomic_size_t *acquiring;
+    for(;;)
+    {
+        size_t epoch = atomic_load(&cv->epoch);
+        acquiring = &cv->acquiring[epoch & 1];
+        atomic_fetch_add(acquiring, 1);
+        if(atomic_load(&cv->epoch) == epoch)
+            break;
+        atomic_fetch_sub(acquiring, 1);
+    }
+
+    CowSnapshot *t = atomic_load(&cv->published);
+    atomic_fetch_add_explicit(&t->refs, 1, memory_order_relaxed);
+    atomic_fetch_sub(acquiring, 1);
+
+    return t;
+}
+
+void cs_release(CowSnapshot *snap)
+{
+    if(snap)
+        table_release(snap);
+}
+
+size_t cs_size(CowSnapshot *snap)
+{
+    return snap ? snap->num_elements : 0;
+}
+
+const void *cs_at(CowSnapshot *snap, size_t index)
+{
+    if(!snap || index >= snap->num_elements)
+        return NULL;
+
+    return snap->chunks[index >> snap->chunk_shift]->data
+           + ((index & (chunk_elems(snap) - 1)) * snap->data_size);
+}
+
+int cs_get(CowSnapshot *snap, void *dest, size_t index)
+{
+    if(!snap || !dest)
+        return -1; // Invalid input
+
+    const void *src = cs_at(snap, index);
+    if(!src)
+        return -2; // Out of bounds
+
+    memcpy(dest, src, snap->data_size);
+
+    return 0;
+}
+
+const void *cs_chunk(CowSnapshot *snap, size_t chunk, size_t *count)
+{
+    if(!snap || chunk >= snap->num_chunks)
+        return NULL;
+
+    if(count)
+    {
+        size_t begin = chunk << snap->chunk_shift;
+        size_t left = snap->num_elements - begin;
+        *count = left < chunk_elems(snap) ? left : chunk_elems(snap);
+    }
+
+    return snap->chunks[chunk]->data;
+}
@@ -0,0 +1,596 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../include/ds_external_sort.h"
+
+#define EXT_DEFAULT_BUDGET      ((size_t)64 << 20)
+#define EXT_DEFAULT_IO_BUFFER   ((size_t)1 << 20)
+
+// Position in one sorted run while merging; the in-memory run has no file
+typedef struct
+{
+    FILE    *file;
+    uint8_t *buffer;
+    size_t  capacity;       // records the read-ahead buffer holds
+    size_t  count;          // records in the buffer
+    size_t  pos;            // next record in the buffer
+    size_t  remaining;      // records in the file past the buffer
+} RunCursor;
+
+typedef struct ExtSorter
+{
+    size_t          data_size;
+    int             (*cmp)(void *a, void *b);
+    size_t          memory_budget;
+    size_t          io_buffer;
+    char            *temp_dir;
+
+    // Run formation: one buffer fills while the other is written out
+    Vector          *buffers[2];
+    int             active;
+
+    FILE            **runs;
+    size_t          *run_lengths;
+    size_t          num_runs;
+    size_t          runs_capacity;
+
+    // Background writer
+    pthread_t       writer;
+    int             writer_started;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    Vector          *job_buffer;
+    FILE            *job_file;
+    int             job_pending;
+    int             shutdown;
+    int             io_error;
+
+    // Merge
+    RunCursor       *cursors;
+    size_t          *tree;          // tree[0] is the winner, tree[1..k-1] hold losers
+    size_t          k;
+    int             finished;
+} ExtSorter;
+
+// ======================= Run Formation ===========================
+
+static void *writer_main(void *arg)
+{
+    ExtSorter *s = arg;
+
+    pthread_mutex_lock(&s->lock);
+    while(1)
+    {
+        while(!s->job_pending && !s->shutdown)
+            pthread_cond_wait(&s->cond, &s->lock);
+
+        if(!s->job_pending)
+            break;
+
+        Vector *buffer = s->job_buffer;
+        FILE *file = s->job_file;
+        pthread_mutex_unlock(&s->lock);
+
+        // One large sequential write per run
+        size_t count;
+        void *data = v_data(buffer, &count);
+        int failed = fwrite(data, s->data_size, count, file) != count || fflush(file) != 0;
+
+        pthread_mutex_lock(&s->lock);
+        s->io_error |= failed;
+        s->job_pending = 0;
+        pthread_cond_broadcast(&s->cond);
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    return NULL;
+}
+
+// Wait until the writer has finished its current run; returns nonzero if any write failed
+static int wait_writer(ExtSorter *s)
+{
+    pthread_mutex_lock(&s->lock);
+    while(s->job_pending)
+        pthread_cond_wait(&s->cond, &s->lock);
+    int failed = s->io_error;
+    pthread_mutex_unlock(&s->lock);
+
+    return failed;
+}
+
+static void stop_writer(ExtSorter *s)
+{
+    if(!s->writer_started)
+        return;
+
+    pthread_mutex_lock(&s->lock);
+    s->shutdown = 1;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+
+    pthread_join(s->writer, NULL);
+    s->writer_started = 0;
+}
+
+// Anonymous temporary file: created in temp_dir and unlinked right away
+static FILE *open_run_file(const ExtSorter *s)
+{
+    size_t len = strlen(s->temp_dir) + sizeof("/ds_extsort_XXXXXX");
+    char *path = malloc(len);
+    if(!path)
+        return NULL;
+
+    snprintf(path, len, "%s/ds_extsort_XXXXXX", s->temp_dir);
+
+    int fd = mkstemp(path);
+    if(fd >= 0)
+        unlink(path);
+    free(path);
+
+    if(fd < 0)
+        return NULL;
+
+    FILE *file = fdopen(fd, "w+b");
+    if(!file)
+        close(fd);
+
+    return file;
+}
+
+// Sort the active buffer and hand it to the writer; the other buffer becomes active
+static int spill(ExtSorter *s)
+{
+    Vector *buffer = s->buffers[s->active];
+
+    // v_sort is an in-place introsort: no extra memory beyond the budget, O(n log n)
+    // and O(log n) stack even for presorted runs or runs of equal keys
+    if(v_sort(buffer, s->cmp))
+        return -2;
+
+    if(s->num_runs == s->runs_capacity)
+    {
+        size_t capacity = s->runs_capacity ? s->runs_capacity * 2 : 16;
+        FILE **runs = realloc(s->runs, capacity * sizeof(FILE *));
+        if(!runs)
+            return -2; // Allocation failed
+        s->runs = runs;
+
+        size_t *lengths = realloc(s->run_lengths, capacity * sizeof(size_t));
+        if(!lengths)
+            return -2; // Allocation failed
+        s->run_lengths = lengths;
+
+        s->runs_capacity = capacity;
+    }
+
+    FILE *file = open_run_file(s);
+    if(!file)
+        return -2; // Could not create temporary file
+
+    s->runs[s->num_runs] = file;
+    s->run_lengths[s->num_runs] = v_size(buffer);
+    s->num_runs++;
+
+    if(!s->writer_started)
+    {
+        if(pthread_create(&s->writer, NULL, writer_main, s) != 0)
+            return -2;
+        s->writer_started = 1;
+    }
+
+    // The other buffer was handed out last time; it is free once that write is done
+    if(wait_writer(s))
+        return -2; // Write failed
+
+    pthread_mutex_lock(&s->lock);
+    s->job_buffer = buffer;
+    s->job_file = file;
+    s->job_pending = 1;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+
+    s->active ^= 1;
+    v_clear(s->buffers[s->active]);
+
+    return 0;
+}
+
+// ======================= Merge ===========================
+
+static int refill(ExtSorter *s, RunCursor *c)
+{
+    c->pos = 0;
+    c->count = c->remaining < c->capacity ? c->remaining : c->capacity;
+
+    if(c->count == 0)
+        return 0;
+
+    if(fread(c->buffer, s->data_size, c->count, c->file) != c->count)
+        return -2; // Read failed
+
+    c->remaining -= c->count;
+
+#if defined(POSIX_FADV_WILLNEED)
+    // Start reading the next block in the background while this one is consumed
+    if(c->remaining > 0)
+    {
+        size_t next = c->remaining < c->capacity ? c->remaining : c->capacity;
+        posix_fadvise(fileno(c->file), ftello(c->file), (off_t)(next * s->data_size), POSIX_FADV_WILLNEED);
+    }
+#endif
+
+    return 0;
+}
+
+static int cursor_done(const RunCursor *c)
+{
+    return c->pos >= c->count;
+}
+
+static uint8_t *cursor_record(const ExtSorter *s, const RunCursor *c)
+{
+    return c->buffer + c->pos * s->data_size;
+}
+
+// Exhausted runs lose to everything; ties go to the earlier run
+static int run_less(ExtSorter *s, size_t a, size_t b)
+{
+    RunCursor *ca = &s->cursors[a];
+    RunCursor *cb = &s->cursors[b];
+
+    if(cursor_done(ca))
+        return 0;
+    if(cursor_done(cb))
+        return 1;
+
+    int c = s->cmp(cursor_record(s, ca), cursor_record(s, cb));
+
+    return c != 0 ? c < 0 : a < b;
+}
+
+static int build_tree(ExtSorter *s)
+{
+    size_t k = s->k;
+
+    s->tree = malloc(k * sizeof(size_t));
+    size_t *win = malloc(2 * k * sizeof(size_t));
+    if(!s->tree || !win)
+    {
+        free(win);
+        return -2; // Allocation failed
+    }
+
+    // Leaves sit at k..2k-1; every internal node keeps the loser and passes the winner up
+    for(size_t i = 0; i < k; i++)
+        win[k + i] = i;
+
+    for(size_t n = k - 1; n >= 1; n--)
+    {
+        size_t a = win[2 * n], b = win[2 * n + 1];
+        int b_wins = run_less(s, b, a);
+
+        win[n] = b_wins ? b : a;
+        s->tree[n] = b_wins ? a : b;
+    }
+
+    s->tree[0] = k > 1 ? win[1] : 0;
+
+    free(win);
+
+    return 0;
+}
+
+// Run `leaf` has a new head record: replay its path to the root
+static void replay(ExtSorter *s, size_t leaf)
+{
+    size_t winner = leaf;
+
+    for(size_t n = (leaf + s->k) / 2; n > 0; n /= 2)
+    {
+        if(run_less(s, s->tree[n], winner))
+        {
+            size_t loser = winner;
+            winner = s->tree[n];
+            s->tree[n] = loser;
+        }
+    }
+
+    s->tree[0] = winner;
+}
+
+// ======================= Public Functions ===========================
+
+ExtSorter *ext_create(size_t data_size, int (*cmp)(void *a, void *b), const ExtSortOptions *opts)
+{
+    if(data_size == 0 || !cmp)
+        return NULL;
+
+    ExtSorter *s = calloc(1, sizeof(ExtSorter));
+    if(!s)
+        return NULL;
+
+    s->data_size = data_size;
+    s->cmp = cmp;
+    s->memory_budget = opts && opts->memory_budget ? opts->memory_budget : EXT_DEFAULT_BUDGET;
+    s->io_buffer = opts && opts->io_buffer ? opts->io_buffer : EXT_DEFAULT_IO_BUFFER;
+
+    const char *dir = opts && opts->temp_dir ? opts->temp_dir : getenv("TMPDIR");
+    s->temp_dir = strdup(dir && *dir ? dir : "/tmp");
+
+    // Two run buffers share the budget so one can be written while the other fills
+    size_t records = s->memory_budget / 2 / data_size;
+    s->buffers[0] = vec_create(records ? records : 1, data_size);
+    s->buffers[1] = vec_create(records ? records : 1, data_size);
+
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->cond, NULL);
+
+    if(!s->temp_dir || !s->buffers[0] || !s->buffers[1])
+    {
+        ext_destroy(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+void ext_destroy(ExtSorter *sorter)
+{
+    if(!sorter)
+        return;
+
+    if(sorter->writer_started)
+    {
+        wait_writer(sorter);
+        stop_writer(sorter);
+    }
+
+    for(size_t i = 0; i < sorter->num_runs; i++)
+        fclose(sorter->runs[i]);
+
+    if(sorter->cursors)
+    {
+        // The in-memory run borrows the buffer vector's storage
+        for(size_t i = 0; i < sorter->k; i++)
+            if(sorter->cursors[i].file)
+                free(sorter->cursors[i].buffer);
+    }
+
+    vec_destroy(sorter->buffers[0]);
+    vec_destroy(sorter->buffers[1]);
+    pthread_mutex_destroy(&sorter->lock);
+    pthread_cond_destroy(&sorter->cond);
+    free(sorter->cursors);
+    free(sorter->tree);
+    free(sorter->runs);
+    free(sorter->run_lengths);
+    free(sorter->temp_dir);
+    free(sorter);
+}
+
+int ext_push_n(ExtSorter *sorter, const void *records, size_t count)
+{
+    if(!sorter || (!records && count > 0) || sorter->finished)
+        return -1; // Invalid input
+
+    const uint8_t *src = records;
+
+    while(count > 0)
+    {
+        Vector *buffer = sorter->buffers[sorter->active];
+        size_t room = v_capacity(buffer) - v_size(buffer);
+
+        // Spill only when more records arrive, so input that fits stays in memory
+        if(room == 0)
+        {
+            if(spill(sorter))
+                return -2; // Sort, allocation or write failed
+            continue;
+        }
+
+        size_t n = room < count ? room : count;
+        if(v_append_n(buffer, src, n))
+            return -2; // Allocation failed
+
+        src += n * sorter->data_size;
+        count -= n;
+    }
+
+    return 0;
+}
+
+int ext_push(ExtSorter *sorter, const void *record)
+{
+    if(!record)
+        return -1; // Invalid input
+
+    return ext_push_n(sorter, record, 1);
+}
+
+int ext_push_vector(ExtSorter *sorter, Vector *vec)
+{
+    if(!sorter || !vec || v_data_size(vec) != sorter->data_size)
+        return -1; // Invalid input
+
+    size_t count;
+    void *data = v_data(vec, &count);
+
+    return ext_push_n(sorter, data, count);
+}
+
+int ext_finish(ExtSorter *sorter)
+{
+    if(!sorter || sorter->finished)
+        return -1; // Invalid input
+
+    sorter->finished = 1;
+
+    // Everything fit in one buffer: sort it and read it back directly
+    if(sorter->num_runs == 0)
+    {
+        Vector *buffer = sorter->buffers[sorter->active];
+
+        sorter->k = 1;
+        sorter->cursors = calloc(1, sizeof(RunCursor));
+        if(!sorter->cursors || v_sort(buffer, sorter->cmp))
+            return -2;
+
+        sorter->cursors[0].buffer = v_data(buffer, &sorter->cursors[0].count);
+        sorter->cursors[0].capacity = sorter->cursors[0].count;
+
+        return build_tree(sorter);
+    }
+
+    if(v_size(sorter->buffers[sorter->active]) > 0 && spill(sorter))
+        return -2;
+
+    if(wait_writer(sorter))
+        return -2; // Write failed
+    stop_writer(sorter);
+
+    // Run buffers are no longer needed; their memory goes to read-ahead
+    vec_destroy(sorter->buffers[0]);
+    vec_destroy(sorter->buffers[1]);
+    sorter->buffers[0] = sorter->buffers[1] = NULL;
+
+    sorter->k = sorter->num_runs;
+    sorter->cursors = calloc(sorter->k, sizeof(RunCursor));
+    if(!sorter->cursors)
+        return -2; // Allocation failed
+
+    size_t bytes = sorter->memory_budget / sorter->k;
+    if(bytes > sorter->io_buffer)
+        bytes = sorter->io_buffer;
+    size_t records = bytes / sorter->data_size ? bytes / sorter->data_size : 1;
+
+    for(size_t i = 0; i < sorter->k; i++)
+    {
+        RunCursor *c = &sorter->cursors[i];
+
+        c->file = sorter->runs[i];
+        c->remaining = sorter->run_lengths[i];
+        c->capacity = records;
+        c->buffer = malloc(records * sorter->data_size);
+        if(!c->buffer)
+            return -2; // Allocation failed
+
+        if(fseeko(c->file, 0, SEEK_SET) != 0)
+            return -2;
+
+#if defined(POSIX_FADV_SEQUENTIAL)
+        posix_fadvise(fileno(c->file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+        if(refill(sorter, c))
+            return -2; // Read failed
+    }
+
+    return build_tree(sorter);
+}
+
+int ext_next(ExtSorter *sorter, void *dest)
+{
+    if(!sorter || !dest || !sorter->finished || !sorter->tree)
+        return -1; // Invalid input
+
+    size_t run = sorter->tree[0];
+    RunCursor *c = &sorter->cursors[run];
+
+    if(cursor_done(c))
+        return 1; // All runs exhausted
+
+    memcpy(dest, cursor_record(sorter, c), sorter->data_size);
+
+    c->pos++;
+    if(cursor_done(c) && c->file && refill(sorter, c))
+        return -2; // Read failed
+
+    replay(sorter, run);
+
+    return 0;
+}
+
+size_t ext_num_runs(ExtSorter *sorter)
+{
+    return sorter ? sorter->num_runs : 0;
+}
+
+int ext_sort_file(const char *input_path, const char *output_path, size_t data_size,
+                  int (*cmp)(void *a, void *b), const ExtSortOptions *opts)
+{
+    if(!input_path || !output_path || data_size == 0 || !cmp)
+        return -1; // Invalid input
+
+    ExtSorter *s = ext_create(data_size, cmp, opts);
+    if(!s)
+        return -2; // Allocation failed
+
+    size_t records = s->io_buffer / data_size ? s->io_buffer / data_size : 1;
+    uint8_t *block = malloc(records * data_size);
+    FILE *in = fopen(input_path, "rb");
+    FILE *out = NULL;
+    int status = 0;
+
+    if(!block || !in)
+        status = -2;
+
+    // Read the input in large blocks; a trailing partial record is an error
+    while(status == 0)
+    {
+        size_t bytes = fread(block, 1, records * data_size, in);
+        if(bytes % data_size)
+            status = -1; // File is not a whole number of records
+        else if(bytes > 0)
+            status = ext_push_n(s, block, bytes / data_size);
+
+        if(bytes < records * data_size)
+        {
+            if(ferror(in))
+                status = -2;
+            break;
+        }
+    }
+
+    if(status == 0)
+        status = ext_finish(s);
+
+    if(status == 0 && !(out = fopen(output_path, "wb")))
+        status = -2;
+
+    // Stream the merged output through the same block buffer
+    size_t filled = 0;
+    while(status == 0)
+    {
+        int rc = ext_next(s, block + filled * data_size);
+        if(rc < 0)
+            status = rc;
+        else if(rc == 0)
+            filled++;
+
+        if((rc == 1 || filled == records) && filled > 0)
+        {
+            if(fwrite(block, data_size, filled, out) != filled)
+                status = -2;
+            filled = 0;
+        }
+
+        if(rc == 1)
+            break;
+    }
+
+    if(out && fclose(out) != 0 && status == 0)
+        status = -2;
+    if(in)
+        fclose(in);
+    free(block);
+    ext_destroy(s);
+
+    return status;
+}
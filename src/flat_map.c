@@ -0,0 +1,289 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/ds_flat_map.h"
+#include "../include/ds_vector.h"
+
+// Unsorted inserts buffered before a merge; lookups scan this many entries at most
+#define FM_TAIL_LIMIT 32
+
+typedef struct FlatMap
+{
+    Vector          *sorted;    // entries in key order, keys unique
+    Vector          *tail;      // recent inserts, unsorted, keys unique and absent from sorted
+    size_t          entry_size;
+    FlatMapCompare  cmp;
+} FlatMap;
+
+// ======================= Helper Functions ===========================
+
+// Index of the entry with this key in the sorted part, or the vector size if absent
+static size_t sorted_find(FlatMap *map, const void *key)
+{
+    size_t index;
+    size_t size = v_size(map->sorted);
+
+    v_lower_bound(map->sorted, key, map->cmp, &index);
+    if(index < size && map->cmp(v_at(map->sorted, index), (void *)key) == 0)
+        return index;
+
+    return size;
+}
+
+static size_t tail_find(FlatMap *map, const void *key)
+{
+    size_t size;
+    uint8_t *entry = v_data(map->tail, &size);
+
+    for(size_t i = 0; i < size; i++, entry += map->entry_size)
+        if(map->cmp(entry, (void *)key) == 0)
+            return i;
+
+    return size;
+}
+
+// Merge m sorted entries with keys not in the map into the sorted vector, back to front in place
+static int merge_sorted(FlatMap *map, const uint8_t *run, size_t m)
+{
+    size_t n = v_size(map->sorted);
+    size_t es = map->entry_size;
+
+    if(m == 0)
+        return 0;
+
+    if(v_set_size(map->sorted, n + m))
+        return -2; // Allocation failed
+
+    uint8_t *arr = v_data(map->sorted, NULL);
+    size_t i = n, j = m, k = n + m;
+
+    while(j > 0)
+    {
+        if(i > 0 && map->cmp(arr + (i - 1) * es, (void *)(run + (j - 1) * es)) > 0)
+            memcpy(arr + --k * es, arr + --i * es, es);
+        else
+            memcpy(arr + --k * es, run + --j * es, es);
+    }
+
+    return 0;
+}
+
+// ======================= Public Functions ===========================
+
+FlatMap *fm_create(size_t entry_size, FlatMapCompare cmp)
+{
+    if(entry_size == 0 || !cmp)
+        return NULL;
+
+    FlatMap *map = malloc(sizeof(FlatMap));
+    if(!map)
+        return NULL;
+
+    map->entry_size = entry_size;
+    map->cmp = cmp;
+    map->sorted = vec_create(16, map->entry_size);
+    map->tail = vec_create(FM_TAIL_LIMIT, map->entry_size);
+
+    if(!map->sorted || !map->tail)
+    {
+        fm_destroy(map);
+        return NULL;
+    }
+
+    return map;
+}
+
+void fm_destroy(FlatMap *map)
+{
+    if(!map)
+        return;
+
+    vec_destroy(map->sorted);
+    vec_destroy(map->tail);
+    free(map);
+}
+
+int fm_insert(FlatMap *map, const void *entry)
+{
+    if(!map || !entry)
+        return -1; // Invalid input
+
+    // Existing keys are overwritten where they are
+    void *found = fm_find(map, entry);
+    if(found)
+    {
+        memcpy(found, entry, map->entry_size);
+        return 1; // Key already present
+    }
+
+    if(v_push_back(map->tail, (void *)entry))
+        return -2; // Allocation failed
+
+    if(v_size(map->tail) >= FM_TAIL_LIMIT && fm_flush(map))
+        return -2; // Allocation failed
+
+    return 0;
+}
+
+int fm_insert_bulk(FlatMap *map, const void *entries, size_t count)
+{
+    if(!map || (!entries && count > 0))
+        return -1; // Invalid input
+
+    if(fm_flush(map))
+        return -2; // Allocation failed
+
+    if(count == 0)
+        return 0;
+
+    Vector *run = vec_create(count, map->entry_size);
+    if(!run)
+        return -2; // Allocation failed
+
+    if(v_append_n(run, entries, count) || v_stable_sort(run, map->cmp))
+    {
+        vec_destroy(run);
+        return -2; // Allocation failed
+    }
+
+    uint8_t *in = v_data(run, NULL);
+    size_t es = map->entry_size;
+    size_t kept = 0;
+
+    // Collapse equal keys, the last one given wins
+    for(size_t r = 0; r < count; r++)
+    {
+        if(kept > 0 && map->cmp(in + (kept - 1) * es, in + r * es) == 0)
+            memcpy(in + (kept - 1) * es, in + r * es, es);
+        else
+        {
+            if(kept != r)
+                memcpy(in + kept * es, in + r * es, es);
+            kept++;
+        }
+    }
+
+    // One linear pass updates keys already in the map and drops them from the run
+    size_t n = v_size(map->sorted);
+    uint8_t *arr = v_data(map->sorted, NULL);
+    size_t i = 0, fresh = 0;
+
+    for(size_t r = 0; r < kept; r++)
+    {
+        while(i < n && map->cmp(arr + i * es, in + r * es) < 0)
+            i++;
+
+        if(i < n && map->cmp(arr + i * es, in + r * es) == 0)
+            memcpy(arr + i * es, in + r * es, es);
+        else
+        {
+            if(fresh != r)
+                memcpy(in + fresh * es, in + r * es, es);
+            fresh++;
+        }
+    }
+
+    int status = merge_sorted(map, in, fresh);
+
+    vec_destroy(run);
+
+    return status;
+}
+
+void *fm_find(FlatMap *map, const void *key)
+{
+    if(!map || !key)
+        return NULL;
+
+    uint8_t *entry = NULL;
+    size_t index = sorted_find(map, key);
+
+    if(index < v_size(map->sorted))
+        entry = v_at(map->sorted, index);
+    else
+    {
+        index = tail_find(map, key);
+        if(index < v_size(map->tail))
+            entry = v_at(map->tail, index);
+    }
+
+    return entry;
+}
+
+int fm_contains(FlatMap *map, const void *key)
+{
+    if(!map || !key)
+        return -1; // Invalid input
+
+    return fm_find(map, key) != NULL;
+}
+
+int fm_erase(FlatMap *map, const void *key)
+{
+    if(!map || !key)
+        return -1; // Invalid input
+
+    size_t index = tail_find(map, key);
+    if(index < v_size(map->tail))
+        return v_swap_remove(map->tail, index);
+
+    index = sorted_find(map, key);
+    if(index < v_size(map->sorted))
+        return v_erase(map->sorted, index);
+
+    return 1; // Key not found
+}
+
+int fm_lower_bound(FlatMap *map, const void *key, size_t *index)
+{
+    if(!map || !key || !index)
+        return -1; // Invalid input
+
+    if(fm_flush(map))
+        return -2; // Allocation failed
+
+    return v_lower_bound(map->sorted, key, map->cmp, index);
+}
+
+void *fm_data(FlatMap *map, size_t *count)
+{
+    if(!map || fm_flush(map))
+        return NULL;
+
+    return v_data(map->sorted, count);
+}
+
+int fm_flush(FlatMap *map)
+{
+    if(!map)
+        return -1; // Invalid input
+
+    size_t m;
+    uint8_t *run = v_data(map->tail, &m);
+
+    if(m == 0)
+        return 0;
+
+    // Tail keys are unique and absent from the sorted part, so any sort will do
+    if(v_sort(map->tail, map->cmp) || merge_sorted(map, run, m))
+        return -2; // Allocation failed
+
+    return v_clear(map->tail);
+}
+
+size_t fm_size(FlatMap *map)
+{
+    return map ? v_size(map->sorted) + v_size(map->tail) : 0;
+}
+
+int fm_clear(FlatMap *map)
+{
+    if(!map)
+        return -1; // Invalid input
+
+    v_clear(map->sorted);
+    v_clear(map->tail);
+
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <limits.h>
 
 #include "../include/ds_heap.h"
 
@@ -13,109 +14,189 @@ typedef struct Heap
     int     num_elements;       // Current number of elements in the heap 
     size_t  data_size;          // Data Type Size in Bytes
     CompareFunc cmp_func;       // User-defined compare function 
+    ElemCompareFunc elem_cmp;   // Pointer-based compare function, used instead of cmp_func if set
+    int     arity;              // Children per node: 2, 4 or 8
+    int     arity_shift;        // log2(arity)
+    void   *block;              // Aligned allocation holding heaparray, NULL if heaparray is the allocation
 } Heap;
 
+#define HP_CACHE_LINE 64
+
 // ======================= Helper Functions ===========================
 
-static void swap(void *dest1, void *dest2, size_t bytes)
+// The array has one slot past heap_size that holds the element being sifted.
+// Keeping it in the array lets the index-based CompareFunc compare against it.
+static void *slot(Heap *heap, int idx)
 {
-    // ========== Swap numbers in generic array ===========
-    
-    // Allocate memory for temporary value for swap
-    void * temp = (void *) malloc(bytes);
-    // Check for malloc failure 
-    if(temp == NULL)
-    {
+    return (uint8_t*)heap->heaparray + (size_t)idx * heap->data_size;
+}
 
-        return;
+// 1 if the element at idx_a belongs above the element at idx_b
+static int above(Heap *heap, int idx_a, int idx_b)
+{
+    if(heap->elem_cmp)
+    {
+        return heap->elem_cmp(slot(heap, idx_a), slot(heap, idx_b)) != 0;
     }
 
-    // Perform Swap
-    memcpy(temp, dest1, bytes);
-    memcpy(dest1, dest2, bytes);
-    memcpy(dest2, temp, bytes);
-
-    // free temporary space
-    free(temp);
+    return heap->cmp_func(heap->heaparray, idx_a, idx_b) == 1;
 }
 
-static void bottom_up_heapify(Heap *heap, int cur_idx)
+static void bottom_up_heapify(Heap *heap, int hole)
 {
     // ========== Used for the insertion ===========
+    // The new element waits in the scratch slot while parents move down into the hole
 
-    // Base case 
-    if(cur_idx == 0)
+    int scratch = heap->heap_size;
+
+    while(hole > 0)
     {
-        return;
-    }
-    
-    int parent_idx = (cur_idx - 1) / 2;
+        int parent_idx = (hole - 1) >> heap->arity_shift;
 
-    // Compare child with parent 
-    if(heap->cmp_func(heap->heaparray, cur_idx, parent_idx) == 1)
-    {   
-        // Perform Swap
-        swap((uint8_t*)heap->heaparray + cur_idx * heap->data_size, (uint8_t*)heap->heaparray + parent_idx * heap->data_size, heap->data_size);
-        bottom_up_heapify(heap, parent_idx);
+        // Stop once the parent belongs above the new element
+        if(!above(heap, scratch, parent_idx))
+        {
+            break;
+        }
+
+        memcpy(slot(heap, hole), slot(heap, parent_idx), heap->data_size);
+        hole = parent_idx;
     }
 
-    return;
+    memcpy(slot(heap, hole), slot(heap, scratch), heap->data_size);
 }
 
 // Heapify for removing
-static void top_bottom_heapify(Heap *heap, int cur_idx)
+static void top_bottom_heapify(Heap *heap, int hole)
+{
+    // The displaced element waits in the scratch slot while children move up into the hole
+
+    int scratch = heap->heap_size;
+
+    for(;;)
+    {
+        // First child index, in size_t: d*hole + 1 can pass INT_MAX before current_index
+        size_t first = ((size_t)hole << heap->arity_shift) + 1;
+
+        if(first >= (size_t)heap->current_index)
+        {
+            break;
+        }
+
+        // first < current_index here, so these stay within int
+        int last = heap->current_index - (int)first > heap->arity ? (int)first + heap->arity : heap->current_index;
+
+        // Pick the child that belongs highest
+        int child = (int)first;
+        for(int c = child + 1; c < last; c++)
+        {
+            if(above(heap, c, child))
+            {
+                child = c;
+            }
+        }
+
+        // Stop once the displaced element belongs above both children
+        if(!above(heap, child, scratch))
+        {
+            break;
+        }
+
+        memcpy(slot(heap, hole), slot(heap, child), heap->data_size);
+        hole = child;
+    }
+
+    memcpy(slot(heap, hole), slot(heap, scratch), heap->data_size);
+}
+
+static void heapify_all(Heap *heap)
 {
-    int largest = cur_idx;  
-    int left = cur_idx * 2 + 1;     // Left child index
-    int right = cur_idx * 2 + 2;    // Right child index
+    // ========== Floyd's bottom-up construction: O(n) ===========
 
-    // Check if left child exists and is greater than the current item
-    if(left < heap->current_index && heap->cmp_func(heap->heaparray, left, largest) == 1)
+    // Leaves are already heaps; with fewer than two elements there is nothing to do
+    if(heap->current_index < 2)
     {
-        largest = left;
+        return;
     }
 
-    // Check if right child exists and is greater than the current largest
-    if(right < heap->current_index && heap->cmp_func(heap->heaparray, right, largest) == 1)
+    // Sift down every internal node, from the parent of the last element up to the root
+    int last_parent = (heap->current_index - 2) >> heap->arity_shift;
+
+    for(int i = last_parent; i >= 0; i--)
     {
-        largest = right;
+        memcpy(slot(heap, heap->heap_size), slot(heap, i), heap->data_size);
+        top_bottom_heapify(heap, i);
     }
+}
 
-    if(largest != cur_idx)
-    {   
-        // Perform Swap 
-        swap((uint8_t*)heap->heaparray + cur_idx * heap->data_size, (uint8_t*)heap->heaparray + largest * heap->data_size, heap->data_size);
-        
-        // Continue heapifying at the new position
-        top_bottom_heapify(heap, largest);
+static void *alloc_array(size_t data_size, size_t slots, int arity, void **block)
+{
+    // 4- and 8-ary heaps put index 1 at the start of a cache line when data_size divides
+    // it. The children of a node (indices d*i+1 .. d*i+d) are then aligned to their own
+    // size, so they occupy ceil(d * data_size / 64) lines: one line when they fit in it,
+    // otherwise they start on a line boundary (two lines for 8 children of 16 bytes)
+    if(arity > 2 && data_size <= HP_CACHE_LINE && HP_CACHE_LINE % data_size == 0)
+    {
+        size_t offset = (HP_CACHE_LINE - data_size) % HP_CACHE_LINE;
+        size_t bytes = (offset + slots * data_size + HP_CACHE_LINE - 1) / HP_CACHE_LINE * HP_CACHE_LINE;
+
+        *block = aligned_alloc(HP_CACHE_LINE, bytes);
+
+        return *block ? (uint8_t*)*block + offset : NULL;
     }
 
-    return;
+    *block = NULL;
+
+    return malloc(slots * data_size);
 }
 
-static size_t resize(void **ptr, size_t data_size, size_t current_size)
+static size_t resize(Heap *heap)
 {
     // Resize array to twice as many elements 
 
-    size_t new_size = current_size * 2;
+    size_t new_size = (size_t)heap->heap_size * 2;
 
-    void *temp = realloc(*ptr, new_size * data_size);
+    if(new_size > INT_MAX)
+    {
+        return 0;
+    }
 
+    if(heap->block == NULL)
+    {
+        // One extra slot for the scratch element
+        void *temp = realloc(heap->heaparray, (new_size + 1) * heap->data_size);
+
+        if(temp == NULL)
+        {
+            return 0;
+        }
+
+        heap->heaparray = temp;
+
+        return new_size;
+    }
+
+    // realloc does not keep the alignment, so move to a new aligned block
+    void *block;
+    void *temp = alloc_array(heap->data_size, new_size + 1, heap->arity, &block);
 
     if(temp == NULL)
     {
         return 0;
     }
 
-    *ptr = temp;
+    memcpy(temp, heap->heaparray, (size_t)heap->current_index * heap->data_size);
+    free(heap->block);
+
+    heap->heaparray = temp;
+    heap->block = block;
 
     return new_size;
 }
 
 // ============================= PRIMARY FUNCTIONS ====================================
 
-// Initialize Heap Function  
-Heap *hp_init(size_t data_size, int heap_size, CompareFunc comp_func)
+static Heap *heap_create(size_t data_size, int heap_size, int arity, CompareFunc comp_func, ElemCompareFunc elem_cmp)
 {
     // Input: requested num_elem for the heap
     // Output: pointer to the heap data structure 
@@ -132,7 +213,13 @@ Heap *hp_init(size_t data_size, int heap_size, CompareFunc comp_func)
         return NULL; 
     }
 
-    if(!comp_func)
+    // Exactly one of the compare functions
+    if(!comp_func == !elem_cmp)
+    {
+        return NULL;
+    }
+
+    if(arity != 2 && arity != 4 && arity != 8)
     {
         return NULL;
     }
@@ -146,8 +233,8 @@ Heap *hp_init(size_t data_size, int heap_size, CompareFunc comp_func)
     }
 
     // Dynamically allocate space for heap elements
-    // void *
-    heapptr->heaparray = (void *)malloc(data_size * heap_size);
+    // plus one scratch slot used while sifting
+    heapptr->heaparray = alloc_array(data_size, (size_t)heap_size + 1, arity, &heapptr->block);
 
     if(heapptr->heaparray == NULL)
     {
@@ -160,11 +247,126 @@ Heap *hp_init(size_t data_size, int heap_size, CompareFunc comp_func)
     heapptr->heap_size = heap_size;
     heapptr->data_size = data_size;
     heapptr->cmp_func = comp_func;
+    heapptr->elem_cmp = elem_cmp;
     heapptr->num_elements = 0;
+    heapptr->arity = arity;
+    heapptr->arity_shift = arity == 2 ? 1 : arity == 4 ? 2 : 3;
 
     return heapptr;
 }
 
+// Initialize Heap Function  
+Heap *hp_init(size_t data_size, int heap_size, CompareFunc comp_func)
+{
+    return heap_create(data_size, heap_size, 2, comp_func, NULL);
+}
+
+// Initialize a heap whose nodes have arity (2, 4 or 8) children
+Heap *hp_init_dary(size_t data_size, int heap_size, int arity, CompareFunc comp_func)
+{
+    return heap_create(data_size, heap_size, arity, comp_func, NULL);
+}
+
+// Initialize a heap that compares elements through pointers to them
+Heap *hp_init_elem(size_t data_size, int heap_size, int arity, ElemCompareFunc elem_cmp)
+{
+    return heap_create(data_size, heap_size, arity, NULL, elem_cmp);
+}
+
+// Build a heap that takes ownership of a malloc'd array 
+Heap *hp_build(size_t data_size, void *array, int num_elements, CompareFunc comp_func)
+{
+    // Input: array of num_elements elements allocated with malloc
+    // Output: pointer to the heap, which now owns and frees the array
+
+    if(data_size == 0 || array == NULL || num_elements <= 0 || !comp_func)
+    {
+        return NULL;
+    }
+
+    Heap *heapptr = malloc(sizeof(Heap));
+
+    if(heapptr == NULL)
+    {
+        return NULL;
+    }
+
+    // Grow by the scratch slot; usually done in place by realloc
+    void *temp = realloc(array, ((size_t)num_elements + 1) * data_size);
+
+    if(temp == NULL)
+    {
+        free(heapptr);
+        return NULL;
+    }
+
+    heapptr->heaparray = temp;
+    heapptr->current_index = num_elements;
+    heapptr->heap_size = num_elements;
+    heapptr->data_size = data_size;
+    heapptr->cmp_func = comp_func;
+    heapptr->elem_cmp = NULL;
+    heapptr->num_elements = num_elements;
+    heapptr->arity = 2;
+    heapptr->arity_shift = 1;
+    heapptr->block = NULL;
+
+    heapify_all(heapptr);
+
+    return heapptr;
+}
+
+// Build a heap from a copy of an array 
+Heap *hp_from_array(size_t data_size, const void *array, int num_elements, CompareFunc comp_func)
+{
+    // Input: array of num_elements elements, left unchanged
+    // Output: pointer to the heap
+
+    if(num_elements < 0 || (array == NULL && num_elements > 0))
+    {
+        return NULL;
+    }
+
+    // Keep at least one slot so the heap can grow by doubling
+    Heap *heapptr = hp_init(data_size, num_elements > 0 ? num_elements : 1, comp_func);
+
+    if(heapptr == NULL)
+    {
+        return NULL;
+    }
+
+    if(num_elements > 0)
+    {
+        memcpy(heapptr->heaparray, array, (size_t)num_elements * data_size);
+    }
+
+    heapptr->current_index = num_elements;
+    heapptr->num_elements = num_elements;
+
+    heapify_all(heapptr);
+
+    return heapptr;
+}
+
+// Build a heap from a copy of a Vector's elements
+Heap *hp_from_vector(Vector *vec, CompareFunc comp_func)
+{
+    if(vec == NULL)
+    {
+        return NULL;
+    }
+
+    size_t size;
+    const void *data = v_data(vec, &size);
+
+    if(size > INT_MAX)
+    {
+        return NULL;
+    }
+
+    return hp_from_array(v_data_size(vec), data, (int)size, comp_func);
+}
+
 int hp__insert_internal(Heap *heap, void *data)
 {
     // Return  0 if success 
@@ -178,7 +380,7 @@ int hp__insert_internal(Heap *heap, void *data)
     if(heap->current_index > heap->heap_size - 1)
     {   
         // Make array twice larger
-        size_t new_size = resize(&heap->heaparray, heap->data_size, heap->heap_size);
+        size_t new_size = resize(heap);
 
         if(new_size == 0)
         {
@@ -187,7 +389,7 @@ int hp__insert_internal(Heap *heap, void *data)
         heap->heap_size = new_size;
     }   
 
-    memcpy((uint8_t*)heap->heaparray + (heap->current_index * heap->data_size), data, heap->data_size);
+    memcpy(slot(heap, heap->heap_size), data, heap->data_size);
 
     bottom_up_heapify(heap, heap->current_index);
 
@@ -203,6 +405,14 @@ int hp_remove_top(Heap *heap)
     // Input pointer to heap & pointer to user-built compare function
     // Output: 0 if success, -1 if failure 
 
+    return hp_pop(heap, NULL);
+}
+
+int hp_pop(Heap *heap, void *dest_ptr)
+{
+    // Purpose: copy the top item into dest_ptr (if not NULL) and remove it
+    // Output: 0 if success, -1 if failure
+
     if(heap == NULL)
     {
         return -1;
@@ -214,20 +424,96 @@ int hp_remove_top(Heap *heap)
         return -1;
     }
 
-    // Cast heap array to be able to perform pointer arithmetic 
-    uint8_t *heaparr = (uint8_t*)heap->heaparray;
-
-    // Move the lowest item of the heap to the top 
-    memcpy(heaparr, heaparr + (heap->current_index - 1) * heap->data_size, heap->data_size);
+    if(dest_ptr)
+    {
+        memcpy(dest_ptr, slot(heap, 0), heap->data_size);
+    }
 
     heap->current_index--;
     heap->num_elements--;
-    // Perform top bottom heapification
+
+    // Sift the lowest item of the heap down from the empty top
+    memcpy(slot(heap, heap->heap_size), slot(heap, heap->current_index), heap->data_size);
+    top_bottom_heapify(heap, 0);
+
+    return 0;
+}
+
+int hp_pushpop(Heap *heap, const void *data, void *dest_ptr)
+{
+    // Purpose: insert data, then pop the top item into dest_ptr
+    // Output: 0 if success, -1 if failure
+
+    if(heap == NULL || data == NULL || dest_ptr == NULL)
+    {
+        return -1;
+    }
+
+    // Stage the new item in the scratch slot so it can be compared
+    memcpy(slot(heap, heap->heap_size), data, heap->data_size);
+
+    // The new item would be the top itself: hand it straight back
+    if(heap->current_index == 0 || !above(heap, 0, heap->heap_size))
+    {
+        memcpy(dest_ptr, slot(heap, heap->heap_size), heap->data_size);
+        return 0;
+    }
+
+    memcpy(dest_ptr, slot(heap, 0), heap->data_size);
     top_bottom_heapify(heap, 0);
 
     return 0;
 }
 
+int hp_replace_top(Heap *heap, const void *data, void *dest_ptr)
+{
+    // Purpose: pop the top item into dest_ptr (if not NULL), then insert data
+    // Output: 0 if success, -1 if failure (including an empty heap)
+
+    if(heap == NULL || data == NULL)
+    {
+        return -1;
+    }
+
+    if(heap->current_index == 0)
+    {
+        return -1;
+    }
+
+    // Stage first: dest_ptr and data may be the same buffer
+    memcpy(slot(heap, heap->heap_size), data, heap->data_size);
+
+    if(dest_ptr)
+    {
+        memcpy(dest_ptr, slot(heap, 0), heap->data_size);
+    }
+
+    // One sift down from the top replaces a pop followed by an insert
+    top_bottom_heapify(heap, 0);
+
+    return 0;
+}
+
+int hp_pop_n(Heap *heap, void *dest_ptr, int count)
+{
+    // Purpose: pop up to count items, in heap order, into the array dest_ptr
+    // Output: number of items popped, -1 if failure
+
+    if(heap == NULL || dest_ptr == NULL || count < 0)
+    {
+        return -1;
+    }
+
+    int popped = 0;
+
+    while(popped < count && hp_pop(heap, (uint8_t*)dest_ptr + (size_t)popped * heap->data_size) == 0)
+    {
+        popped++;
+    }
+
+    return popped;
+}
+
 int hp_peek(Heap *heap, void *dest_ptr)
 {
     // Input: pointer to heap, void* to a memory to save top value  
@@ -261,6 +547,6 @@ void hp_destroy(Heap *heap)
         return;
     }
     // Deallocation //
-    free(heap->heaparray);
+    free(heap->block ? heap->block : heap->heaparray);
     free(heap);
 }
\ No newline at end of file
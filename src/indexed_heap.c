@@ -0,0 +1,305 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/ds_indexed_heap.h"
+
+// Position of a handle that holds no element
+#define IH_FREE SIZE_MAX
+
+typedef struct IndexedHeap
+{
+    uint8_t         *items;         // element of handle h at items + h * data_size
+    size_t          *heap;          // handles in heap order
+    size_t          *pos;           // heap position of each handle, IH_FREE if unused
+    size_t          *free_handles;  // stack of released handles
+    size_t          num_free;
+    size_t          num_handles;    // handles ever handed out (unused ones are on the stack)
+    size_t          num_elements;
+    size_t          capacity;
+    size_t          data_size;
+    ElemCompareFunc cmp;
+} IndexedHeap;
+
+// ======================= Helper Functions ===========================
+
+static void *item(IndexedHeap *heap, size_t handle)
+{
+    return heap->items + handle * heap->data_size;
+}
+
+static int above(IndexedHeap *heap, size_t a, size_t b)
+{
+    return heap->cmp(item(heap, a), item(heap, b)) != 0;
+}
+
+// Only handles move while sifting; each one moved updates its position
+static size_t sift_up(IndexedHeap *heap, size_t hole)
+{
+    size_t handle = heap->heap[hole];
+
+    while(hole > 0)
+    {
+        size_t parent = (hole - 1) / 2;
+        if(!above(heap, handle, heap->heap[parent]))
+            break;
+
+        heap->heap[hole] = heap->heap[parent];
+        heap->pos[heap->heap[hole]] = hole;
+        hole = parent;
+    }
+
+    heap->heap[hole] = handle;
+    heap->pos[handle] = hole;
+
+    return hole;
+}
+
+static void sift_down(IndexedHeap *heap, size_t hole)
+{
+    size_t handle = heap->heap[hole];
+
+    for(;;)
+    {
+        size_t child = hole * 2 + 1;
+        if(child >= heap->num_elements)
+            break;
+
+        if(child + 1 < heap->num_elements && above(heap, heap->heap[child + 1], heap->heap[child]))
+            child++;
+
+        if(!above(heap, heap->heap[child], handle))
+            break;
+
+        heap->heap[hole] = heap->heap[child];
+        heap->pos[heap->heap[hole]] = hole;
+        hole = child;
+    }
+
+    heap->heap[hole] = handle;
+    heap->pos[handle] = hole;
+}
+
+// Restore the order around a position whose element changed in either direction
+static void sift(IndexedHeap *heap, size_t position)
+{
+    if(sift_up(heap, position) == position)
+        sift_down(heap, position);
+}
+
+static int grow(IndexedHeap *heap)
+{
+    size_t capacity = heap->capacity * 2;
+
+    uint8_t *items = realloc(heap->items, capacity * heap->data_size);
+    if(!items)
+        return -2;
+    heap->items = items;
+
+    size_t *order = realloc(heap->heap, capacity * sizeof(size_t));
+    if(!order)
+        return -2;
+    heap->heap = order;
+
+    size_t *pos = realloc(heap->pos, capacity * sizeof(size_t));
+    if(!pos)
+        return -2;
+    heap->pos = pos;
+
+    size_t *free_handles = realloc(heap->free_handles, capacity * sizeof(size_t));
+    if(!free_handles)
+        return -2;
+    heap->free_handles = free_handles;
+
+    heap->capacity = capacity;
+
+    return 0;
+}
+
+static int valid_handle(IndexedHeap *heap, size_t handle)
+{
+    return handle < heap->num_handles && heap->pos[handle] != IH_FREE;
+}
+
+// Take the element at a heap position out and release its handle
+static void remove_at(IndexedHeap *heap, size_t position, void *dest)
+{
+    size_t handle = heap->heap[position];
+
+    if(dest)
+        memcpy(dest, item(heap, handle), heap->data_size);
+
+    heap->pos[handle] = IH_FREE;
+    heap->free_handles[heap->num_free++] = handle;
+    heap->num_elements--;
+
+    // Fill the gap with the last element, which may need to go either way
+    if(position < heap->num_elements)
+    {
+        heap->heap[position] = heap->heap[heap->num_elements];
+        heap->pos[heap->heap[position]] = position;
+        sift(heap, position);
+    }
+}
+
+// ============================= PRIMARY FUNCTIONS ====================================
+
+IndexedHeap *ih_create(size_t data_size, size_t capacity, ElemCompareFunc cmp)
+{
+    if(data_size == 0 || !cmp)
+        return NULL;
+
+    IndexedHeap *heap = calloc(1, sizeof(IndexedHeap));
+    if(!heap)
+        return NULL;
+
+    heap->data_size = data_size;
+    heap->cmp = cmp;
+    heap->capacity = capacity ? capacity : 16;
+    heap->items = malloc(heap->capacity * data_size);
+    heap->heap = malloc(heap->capacity * sizeof(size_t));
+    heap->pos = malloc(heap->capacity * sizeof(size_t));
+    heap->free_handles = malloc(heap->capacity * sizeof(size_t));
+
+    if(!heap->items || !heap->heap || !heap->pos || !heap->free_handles)
+    {
+        ih_destroy(heap);
+        return NULL;
+    }
+
+    return heap;
+}
+
+void ih_destroy(IndexedHeap *heap)
+{
+    if(!heap)
+        return;
+
+    free(heap->items);
+    free(heap->heap);
+    free(heap->pos);
+    free(heap->free_handles);
+    free(heap);
+}
+
+int ih_insert(IndexedHeap *heap, const void *data, size_t *handle)
+{
+    if(!heap || !data)
+        return -1; // Invalid input
+
+    size_t h;
+    if(heap->num_free > 0)
+        h = heap->free_handles[--heap->num_free];
+    else
+    {
+        if(heap->num_handles == heap->capacity && grow(heap))
+            return -2; // Allocation failed
+        h = heap->num_handles++;
+    }
+
+    memcpy(item(heap, h), data, heap->data_size);
+    heap->heap[heap->num_elements] = h;
+    heap->num_elements++;
+    sift_up(heap, heap->num_elements - 1);
+
+    if(handle)
+        *handle = h;
+
+    return 0;
+}
+
+int ih_peek(IndexedHeap *heap, void *dest, size_t *handle)
+{
+    if(!heap)
+        return -1; // Invalid input
+
+    if(heap->num_elements == 0)
+        return 1; // Empty heap
+
+    if(dest)
+        memcpy(dest, item(heap, heap->heap[0]), heap->data_size);
+    if(handle)
+        *handle = heap->heap[0];
+
+    return 0;
+}
+
+int ih_pop(IndexedHeap *heap, void *dest, size_t *handle)
+{
+    if(!heap)
+        return -1; // Invalid input
+
+    if(heap->num_elements == 0)
+        return 1; // Empty heap
+
+    if(handle)
+        *handle = heap->heap[0];
+
+    remove_at(heap, 0, dest);
+
+    return 0;
+}
+
+int ih_get(IndexedHeap *heap, size_t handle, void *dest)
+{
+    if(!heap || !dest || !valid_handle(heap, handle))
+        return -1; // Invalid input or stale handle
+
+    memcpy(dest, item(heap, handle), heap->data_size);
+
+    return 0;
+}
+
+void *ih_at(IndexedHeap *heap, size_t handle)
+{
+    if(!heap || !valid_handle(heap, handle))
+        return NULL;
+
+    return item(heap, handle);
+}
+
+int ih_update_priority(IndexedHeap *heap, size_t handle, const void *data)
+{
+    if(!heap || !valid_handle(heap, handle))
+        return -1; // Invalid input or stale handle
+
+    // NULL data: the caller changed the element in place through ih_at
+    if(data)
+        memcpy(item(heap, handle), data, heap->data_size);
+
+    sift(heap, heap->pos[handle]);
+
+    return 0;
+}
+
+int ih_remove(IndexedHeap *heap, size_t handle, void *dest)
+{
+    if(!heap || !valid_handle(heap, handle))
+        return -1; // Invalid input or stale handle
+
+    remove_at(heap, heap->pos[handle], dest);
+
+    return 0;
+}
+
+int ih_contains(IndexedHeap *heap, size_t handle)
+{
+    return heap && valid_handle(heap, handle);
+}
+
+size_t ih_size(IndexedHeap *heap)
+{
+    return heap ? heap->num_elements : 0;
+}
+
+int ih_clear(IndexedHeap *heap)
+{
+    if(!heap)
+        return -1; // Invalid input
+
+    heap->num_elements = 0;
+    heap->num_handles = 0;
+    heap->num_free = 0;
+
+    return 0;
+}
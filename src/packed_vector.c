@@ -0,0 +1,612 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/ds_packed_vector.h"
+#include "../include/ds_vector_simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define PV_HAVE_X86_SIMD
+#endif
+
+// Bytes kept zeroed after the packed bits so every read can load 9 bytes
+#define PV_PADDING 16
+
+// Values per DeltaVector block
+#define DV_BLOCK 128
+
+typedef struct PackedVector
+{
+    uint8_t     *bytes;         // little-endian bit stream, value i at bit i * bits
+    size_t      num_elements;
+    size_t      capacity;
+    unsigned    bits;
+} PackedVector;
+
+typedef struct
+{
+    uint64_t    base;           // first value of the block
+    size_t      offset;         // byte offset of the packed gaps in the stream
+    unsigned    bits;           // width of every gap, 0 if the block is constant
+} DeltaBlock;
+
+typedef struct DeltaVector
+{
+    DeltaBlock  *blocks;
+    size_t      num_blocks;
+    size_t      blocks_capacity;
+    uint8_t     *stream;
+    size_t      stream_size;
+    size_t      stream_capacity;
+    uint64_t    pending[DV_BLOCK];  // the open last block, not yet packed
+    size_t      num_pending;
+    size_t      num_elements;
+} DeltaVector;
+
+// ======================= Bit Stream ===========================
+
+static uint64_t load_le64(const uint8_t *p)
+{
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap64(w);
+#endif
+    return w;
+}
+
+static void store_le64(uint8_t *p, uint64_t w)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap64(w);
+#endif
+    memcpy(p, &w, sizeof(w));
+}
+
+static uint64_t low_mask(unsigned bits)
+{
+    return bits >= 64 ? UINT64_MAX : ((uint64_t)1 << bits) - 1;
+}
+
+static unsigned bit_width(uint64_t x)
+{
+    return x ? 64 - (unsigned)__builtin_clzll(x) : 0;
+}
+
+static uint64_t bits_read(const uint8_t *bytes, size_t pos, unsigned bits)
+{
+    const uint8_t *p = bytes + (pos >> 3);
+    unsigned shift = pos & 7;
+    uint64_t v = load_le64(p) >> shift;
+
+    // Widths above 56 bits can spill into a ninth byte
+    if(shift + bits > 64)
+        v |= (uint64_t)p[8] << (64 - shift);
+
+    return v & low_mask(bits);
+}
+
+static void bits_write(uint8_t *bytes, size_t pos, unsigned bits, uint64_t value)
+{
+    uint8_t *p = bytes + (pos >> 3);
+    unsigned shift = pos & 7;
+    uint64_t mask = low_mask(bits);
+
+    store_le64(p, (load_le64(p) & ~(mask << shift)) | ((value & mask) << shift));
+
+    if(shift + bits > 64)
+    {
+        uint8_t high = (uint8_t)((1u << (shift + bits - 64)) - 1);
+        p[8] = (uint8_t)((p[8] & ~high) | ((value >> (64 - shift)) & high));
+    }
+}
+
+// Pack n values (uint32_t or uint64_t, by width) into a zeroed stream starting at bit 0
+static void pack_run(uint8_t *out, const void *src, size_t width, size_t n, unsigned bits)
+{
+    uint64_t acc = 0;
+    unsigned fill = 0;
+
+    for(size_t i = 0; i < n; i++)
+    {
+        uint64_t v = width == sizeof(uint32_t) ? ((const uint32_t *)src)[i] : ((const uint64_t *)src)[i];
+
+        acc |= v << fill;
+        if(fill + bits >= 64)
+        {
+            store_le64(out, acc);
+            out += 8;
+            acc = fill ? v >> (64 - fill) : 0;
+            fill = fill + bits - 64;
+        }
+        else
+            fill += bits;
+    }
+
+    if(fill > 0)
+        store_le64(out, acc);
+}
+
+static void unpack_scalar(const uint8_t *bytes, size_t pos, unsigned bits, size_t n, uint64_t *out)
+{
+    for(size_t i = 0; i < n; i++, pos += bits)
+        out[i] = bits_read(bytes, pos, bits);
+}
+
+#ifdef PV_HAVE_X86_SIMD
+// Four values per step: gather 8 bytes at each value's first byte, shift and mask
+__attribute__((target("avx2")))
+static void unpack_avx2(const uint8_t *bytes, size_t pos, unsigned bits, size_t n, uint64_t *out)
+{
+    size_t i = 0;
+
+    if(bits <= 56)
+    {
+        __m256i mask = _mm256_set1_epi64x((long long)low_mask(bits));
+        __m256i seven = _mm256_set1_epi64x(7);
+        __m256i step = _mm256_set1_epi64x((long long)(4 * bits));
+        __m256i bitpos = _mm256_set_epi64x((long long)(pos + 3 * bits), (long long)(pos + 2 * bits),
+                                           (long long)(pos + bits), (long long)pos);
+
+        for(; i + 4 <= n; i += 4)
+        {
+            __m256i offsets = _mm256_srli_epi64(bitpos, 3);
+            __m256i shifts = _mm256_and_si256(bitpos, seven);
+            __m256i words = _mm256_i64gather_epi64((const long long *)bytes, offsets, 1);
+
+            words = _mm256_and_si256(_mm256_srlv_epi64(words, shifts), mask);
+            _mm256_storeu_si256((__m256i *)(out + i), words);
+            bitpos = _mm256_add_epi64(bitpos, step);
+        }
+    }
+
+    unpack_scalar(bytes, pos + i * bits, bits, n - i, out + i);
+}
+#endif
+
+static void unpack(const uint8_t *bytes, size_t pos, unsigned bits, size_t n, uint64_t *out)
+{
+    if(bits == 0)
+    {
+        memset(out, 0, n * sizeof(uint64_t));
+        return;
+    }
+
+#ifdef PV_HAVE_X86_SIMD
+    if(v_simd_level() >= V_SIMD_AVX2)
+    {
+        unpack_avx2(bytes, pos, bits, n, out);
+        return;
+    }
+#endif
+
+    unpack_scalar(bytes, pos, bits, n, out);
+}
+
+static size_t packed_bytes(size_t n, unsigned bits)
+{
+    return (n * bits + 7) / 8 + PV_PADDING;
+}
+
+// Element width of a Vector of unsigned integers, 0 if unsupported
+static size_t unsigned_width(Vector *vec, VecKeyType type)
+{
+    if(type == V_KEY_U32 && v_data_size(vec) == sizeof(uint32_t))
+        return sizeof(uint32_t);
+    if(type == V_KEY_U64 && v_data_size(vec) == sizeof(uint64_t))
+        return sizeof(uint64_t);
+
+    return 0;
+}
+
+static uint64_t element(const void *data, size_t width, size_t i)
+{
+    return width == sizeof(uint32_t) ? ((const uint32_t *)data)[i] : ((const uint64_t *)data)[i];
+}
+
+// ======================= Packed Vector ===========================
+
+PackedVector *pv_create(unsigned bits, size_t capacity)
+{
+    if(bits == 0 || bits > 64)
+        return NULL;
+
+    PackedVector *pv = malloc(sizeof(PackedVector));
+    if(!pv)
+        return NULL;
+
+    pv->bits = bits;
+    pv->num_elements = 0;
+    pv->capacity = capacity ? capacity : 16;
+    pv->bytes = calloc(packed_bytes(pv->capacity, bits), 1);
+    if(!pv->bytes)
+    {
+        free(pv);
+        return NULL;
+    }
+
+    return pv;
+}
+
+PackedVector *pv_from_vector(Vector *vec, VecKeyType type)
+{
+    if(!vec)
+        return NULL;
+
+    size_t width = unsigned_width(vec, type);
+    if(!width)
+        return NULL; // Only uint32_t and uint64_t vectors
+
+    size_t n;
+    const void *data = v_data(vec, &n);
+
+    // Narrowest width that holds the largest value
+    uint64_t max = 0;
+    for(size_t i = 0; i < n; i++)
+    {
+        uint64_t v = element(data, width, i);
+        max = v > max ? v : max;
+    }
+
+    unsigned bits = bit_width(max);
+    PackedVector *pv = pv_create(bits ? bits : 1, n);
+    if(!pv)
+        return NULL;
+
+    pack_run(pv->bytes, data, width, n, pv->bits);
+    pv->num_elements = n;
+
+    return pv;
+}
+
+void pv_destroy(PackedVector *pv)
+{
+    if(!pv)
+        return;
+
+    free(pv->bytes);
+    free(pv);
+}
+
+int pv_push_back(PackedVector *pv, uint64_t value)
+{
+    if(!pv || value > low_mask(pv->bits))
+        return -1; // Invalid input or value too wide
+
+    if(pv->num_elements == pv->capacity)
+    {
+        size_t capacity = pv->capacity * 2;
+        size_t old_bytes = packed_bytes(pv->capacity, pv->bits);
+        size_t new_bytes = packed_bytes(capacity, pv->bits);
+
+        uint8_t *bytes = realloc(pv->bytes, new_bytes);
+        if(!bytes)
+            return -2; // Allocation failed
+
+        memset(bytes + old_bytes, 0, new_bytes - old_bytes);
+        pv->bytes = bytes;
+        pv->capacity = capacity;
+    }
+
+    bits_write(pv->bytes, pv->num_elements * pv->bits, pv->bits, value);
+    pv->num_elements++;
+
+    return 0;
+}
+
+int pv_get(PackedVector *pv, size_t index, uint64_t *value)
+{
+    if(!pv || !value)
+        return -1; // Invalid input
+
+    if(index >= pv->num_elements)
+        return -2; // Index out of bounds
+
+    *value = bits_read(pv->bytes, index * pv->bits, pv->bits);
+
+    return 0;
+}
+
+int pv_set(PackedVector *pv, size_t index, uint64_t value)
+{
+    if(!pv || value > low_mask(pv->bits))
+        return -1; // Invalid input or value too wide
+
+    if(index >= pv->num_elements)
+        return -2; // Index out of bounds
+
+    bits_write(pv->bytes, index * pv->bits, pv->bits, value);
+
+    return 0;
+}
+
+int pv_decode(PackedVector *pv, size_t start, size_t count, uint64_t *out)
+{
+    if(!pv || (!out && count > 0))
+        return -1; // Invalid input
+
+    if(start > pv->num_elements || count > pv->num_elements - start)
+        return -2; // Range out of bounds
+
+    unpack(pv->bytes, start * pv->bits, pv->bits, count, out);
+
+    return 0;
+}
+
+size_t pv_size(PackedVector *pv)
+{
+    return pv ? pv->num_elements : 0;
+}
+
+unsigned pv_bits(PackedVector *pv)
+{
+    return pv ? pv->bits : 0;
+}
+
+size_t pv_memory(PackedVector *pv)
+{
+    return pv ? sizeof(PackedVector) + packed_bytes(pv->capacity, pv->bits) : 0;
+}
+
+// ======================= Delta Vector ===========================
+
+// Pack the pending values as one block: base plus gaps, the first gap being zero
+static int seal_block(DeltaVector *dv)
+{
+    uint64_t gaps[DV_BLOCK];
+    uint64_t max = 0;
+
+    gaps[0] = 0;
+    for(size_t i = 1; i < DV_BLOCK; i++)
+    {
+        gaps[i] = dv->pending[i] - dv->pending[i - 1];
+        max = gaps[i] > max ? gaps[i] : max;
+    }
+
+    unsigned bits = bit_width(max);
+    size_t bytes = (size_t)DV_BLOCK * bits / 8;
+
+    if(dv->num_blocks == dv->blocks_capacity)
+    {
+        size_t capacity = dv->blocks_capacity ? dv->blocks_capacity * 2 : 16;
+        DeltaBlock *blocks = realloc(dv->blocks, capacity * sizeof(DeltaBlock));
+        if(!blocks)
+            return -2; // Allocation failed
+        dv->blocks = blocks;
+        dv->blocks_capacity = capacity;
+    }
+
+    if(dv->stream_size + bytes + PV_PADDING > dv->stream_capacity)
+    {
+        size_t capacity = dv->stream_capacity ? dv->stream_capacity * 2 : 1024;
+        while(capacity < dv->stream_size + bytes + PV_PADDING)
+            capacity *= 2;
+
+        uint8_t *stream = realloc(dv->stream, capacity);
+        if(!stream)
+            return -2; // Allocation failed
+
+        memset(stream + dv->stream_capacity, 0, capacity - dv->stream_capacity);
+        dv->stream = stream;
+        dv->stream_capacity = capacity;
+    }
+
+    if(bits)
+        pack_run(dv->stream + dv->stream_size, gaps, sizeof(uint64_t), DV_BLOCK, bits);
+
+    dv->blocks[dv->num_blocks++] = (DeltaBlock){ dv->pending[0], dv->stream_size, bits };
+    dv->stream_size += bytes;
+    dv->num_pending = 0;
+
+    return 0;
+}
+
+// Decode a sealed block into 128 absolute values
+static void decode_block(const DeltaVector *dv, size_t block, uint64_t *out)
+{
+    const DeltaBlock *b = &dv->blocks[block];
+
+    unpack(dv->stream + b->offset, 0, b->bits, DV_BLOCK, out);
+
+    uint64_t value = b->base;
+    for(size_t i = 0; i < DV_BLOCK; i++)
+    {
+        value += out[i];
+        out[i] = value;
+    }
+}
+
+DeltaVector *dv_create(void)
+{
+    return calloc(1, sizeof(DeltaVector));
+}
+
+DeltaVector *dv_from_vector(Vector *vec, VecKeyType type)
+{
+    if(!vec)
+        return NULL;
+
+    size_t width = unsigned_width(vec, type);
+    if(!width)
+        return NULL; // Only uint32_t and uint64_t vectors
+
+    size_t n;
+    const void *data = v_data(vec, &n);
+
+    DeltaVector *dv = dv_create();
+    if(!dv)
+        return NULL;
+
+    for(size_t i = 0; i < n; i++)
+    {
+        if(dv_push_back(dv, element(data, width, i)))
+        {
+            dv_destroy(dv);
+            return NULL; // Not sorted or allocation failed
+        }
+    }
+
+    return dv;
+}
+
+void dv_destroy(DeltaVector *dv)
+{
+    if(!dv)
+        return;
+
+    free(dv->blocks);
+    free(dv->stream);
+    free(dv);
+}
+
+int dv_push_back(DeltaVector *dv, uint64_t value)
+{
+    if(!dv)
+        return -1; // Invalid input
+
+    if(dv->num_elements > 0)
+    {
+        uint64_t last = dv->num_pending ? dv->pending[dv->num_pending - 1]
+                                        : dv->pending[DV_BLOCK - 1];
+        if(value < last)
+            return -1; // Values must not decrease
+    }
+
+    dv->pending[dv->num_pending++] = value;
+    dv->num_elements++;
+
+    // A sealed block leaves its values in pending, so the last one is still known above
+    if(dv->num_pending == DV_BLOCK && seal_block(dv))
+    {
+        dv->num_pending--;
+        dv->num_elements--;
+        return -2; // Allocation failed
+    }
+
+    return 0;
+}
+
+int dv_get(DeltaVector *dv, size_t index, uint64_t *value)
+{
+    if(!dv || !value)
+        return -1; // Invalid input
+
+    if(index >= dv->num_elements)
+        return -2; // Index out of bounds
+
+    size_t block = index / DV_BLOCK;
+    size_t offset = index % DV_BLOCK;
+
+    if(block == dv->num_blocks)
+    {
+        *value = dv->pending[offset];
+        return 0;
+    }
+
+    // Only the gaps up to the wanted value are needed
+    const DeltaBlock *b = &dv->blocks[block];
+    uint64_t gaps[DV_BLOCK];
+    uint64_t sum = b->base;
+
+    unpack(dv->stream + b->offset, 0, b->bits, offset + 1, gaps);
+    for(size_t i = 1; i <= offset; i++)
+        sum += gaps[i];
+
+    *value = sum;
+
+    return 0;
+}
+
+int dv_decode(DeltaVector *dv, size_t start, size_t count, uint64_t *out)
+{
+    if(!dv || (!out && count > 0))
+        return -1; // Invalid input
+
+    if(start > dv->num_elements || count > dv->num_elements - start)
+        return -2; // Range out of bounds
+
+    uint64_t values[DV_BLOCK];
+
+    while(count > 0)
+    {
+        size_t block = start / DV_BLOCK;
+        size_t offset = start % DV_BLOCK;
+        size_t n = DV_BLOCK - offset < count ? DV_BLOCK - offset : count;
+
+        if(block == dv->num_blocks)
+            memcpy(out, dv->pending + offset, n * sizeof(uint64_t));
+        else if(offset == 0 && n == DV_BLOCK)
+            decode_block(dv, block, out);
+        else
+        {
+            decode_block(dv, block, values);
+            memcpy(out, values + offset, n * sizeof(uint64_t));
+        }
+
+        out += n;
+        start += n;
+        count -= n;
+    }
+
+    return 0;
+}
+
+int dv_lower_bound(DeltaVector *dv, uint64_t value, size_t *index)
+{
+    if(!dv || !index)
+        return -1; // Invalid input
+
+    // First block whose base is not below the value
+    size_t lo = 0, hi = dv->num_blocks;
+    while(lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if(dv->blocks[mid].base < value)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // The answer is inside the block before it, or that block's first value
+    if(lo > 0)
+    {
+        uint64_t values[DV_BLOCK];
+        decode_block(dv, lo - 1, values);
+        for(size_t i = 0; i < DV_BLOCK; i++)
+        {
+            if(values[i] >= value)
+            {
+                *index = (lo - 1) * DV_BLOCK + i;
+                return 0;
+            }
+        }
+    }
+
+    if(lo < dv->num_blocks)
+    {
+        *index = lo * DV_BLOCK;
+        return 0;
+    }
+
+    size_t i = 0;
+    while(i < dv->num_pending && dv->pending[i] < value)
+        i++;
+
+    *index = dv->num_blocks * DV_BLOCK + i;
+
+    return 0;
+}
+
+size_t dv_size(DeltaVector *dv)
+{
+    return dv ? dv->num_elements : 0;
+}
+
+size_t dv_memory(DeltaVector *dv)
+{
+    if(!dv)
+        return 0;
+
+    return sizeof(DeltaVector) + dv->blocks_capacity * sizeof(DeltaBlock) + dv->stream_capacity;
+}
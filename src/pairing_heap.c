@@ -0,0 +1,353 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../include/ds_pairing_heap.h"
+
+// Element data follows the node header at this alignment
+#define PH_ALIGN            16
+#define PH_ALIGN_UP(x)      (((x) + PH_ALIGN - 1) / PH_ALIGN * PH_ALIGN)
+
+// Nodes per slab: the first slab is small, later ones double up to the limit
+#define PH_SLAB_FIRST       64
+#define PH_SLAB_MAX         65536
+
+typedef struct PairingNode
+{
+    struct PairingNode  *child;     // leftmost child
+    struct PairingNode  *sibling;   // next sibling to the right; next node on the free list
+    struct PairingNode  *prev;      // left sibling, or the parent for a leftmost child
+} PairingNode;
+
+typedef struct PhSlab
+{
+    struct PhSlab   *next;
+} PhSlab;
+
+typedef struct PairingHeap
+{
+    PairingNode     *root;
+    size_t          num_elements;
+    size_t          data_size;
+    size_t          node_size;      // header plus data, aligned
+    ElemCompareFunc cmp;
+    PhSlab          *slabs;         // every slab this heap owns, freed on destroy
+    PhSlab          *slabs_tail;
+    PairingNode     *free_head;     // released nodes, reused before the bump area
+    PairingNode     *free_tail;
+    uint8_t         *bump;          // unused part of the newest slab
+    uint8_t         *bump_end;
+    size_t          next_slab;      // nodes in the next slab
+} PairingHeap;
+
+// ======================= Helper Functions ===========================
+
+static void *node_data(PairingNode *node)
+{
+    return (uint8_t *)node + PH_ALIGN_UP(sizeof(PairingNode));
+}
+
+static PairingNode *alloc_node(PairingHeap *heap)
+{
+    if(heap->free_head)
+    {
+        PairingNode *node = heap->free_head;
+        heap->free_head = node->sibling;
+        if(!heap->free_head)
+            heap->free_tail = NULL;
+        return node;
+    }
+
+    if(heap->bump == heap->bump_end)
+    {
+        size_t header = PH_ALIGN_UP(sizeof(PhSlab));
+        PhSlab *slab = malloc(header + heap->next_slab * heap->node_size);
+        if(!slab)
+            return NULL;
+
+        slab->next = NULL;
+        if(heap->slabs_tail)
+            heap->slabs_tail->next = slab;
+        else
+            heap->slabs = slab;
+        heap->slabs_tail = slab;
+
+        heap->bump = (uint8_t *)slab + header;
+        heap->bump_end = heap->bump + heap->next_slab * heap->node_size;
+        if(heap->next_slab < PH_SLAB_MAX)
+            heap->next_slab *= 2;
+    }
+
+    PairingNode *node = (PairingNode *)heap->bump;
+    heap->bump += heap->node_size;
+
+    return node;
+}
+
+static void free_node(PairingHeap *heap, PairingNode *node)
+{
+    node->sibling = heap->free_head;
+    heap->free_head = node;
+    if(!heap->free_tail)
+        heap->free_tail = node;
+}
+
+// Link two roots: the one that belongs lower becomes the leftmost child of the other
+static PairingNode *link(PairingHeap *heap, PairingNode *a, PairingNode *b)
+{
+    if(!a)
+        return b;
+    if(!b)
+        return a;
+
+    if(heap->cmp(node_data(b), node_data(a)))
+    {
+        PairingNode *t = a;
+        a = b;
+        b = t;
+    }
+
+    b->sibling = a->child;
+    if(a->child)
+        a->child->prev = b;
+    b->prev = a;
+    a->child = b;
+
+    a->sibling = NULL;
+    a->prev = NULL;
+
+    return a;
+}
+
+// Two-pass pairing of a sibling list into a single root
+static PairingNode *merge_pairs(PairingHeap *heap, PairingNode *first)
+{
+    PairingNode *pairs = NULL;
+
+    // Left to right: link neighbours, collecting the results in reverse order
+    while(first)
+    {
+        PairingNode *a = first;
+        PairingNode *b = a->sibling;
+
+        first = b ? b->sibling : NULL;
+
+        PairingNode *m = link(heap, a, b);
+        m->sibling = pairs;
+        pairs = m;
+    }
+
+    if(!pairs)
+        return NULL;
+
+    // Right to left: fold the pairs into one tree
+    PairingNode *root = pairs;
+    pairs = pairs->sibling;
+    while(pairs)
+    {
+        PairingNode *next = pairs->sibling;
+        root = link(heap, root, pairs);
+        pairs = next;
+    }
+
+    root->sibling = NULL;
+    root->prev = NULL;
+
+    return root;
+}
+
+// Detach a non-root node, with its subtree, from its parent
+static void cut(PairingNode *node)
+{
+    if(node->prev->child == node)
+        node->prev->child = node->sibling;
+    else
+        node->prev->sibling = node->sibling;
+
+    if(node->sibling)
+        node->sibling->prev = node->prev;
+
+    node->sibling = NULL;
+    node->prev = NULL;
+}
+
+// ============================= PRIMARY FUNCTIONS ====================================
+
+PairingHeap *ph_create(size_t data_size, ElemCompareFunc cmp)
+{
+    if(data_size == 0 || !cmp)
+        return NULL;
+
+    PairingHeap *heap = calloc(1, sizeof(PairingHeap));
+    if(!heap)
+        return NULL;
+
+    heap->data_size = data_size;
+    heap->node_size = PH_ALIGN_UP(PH_ALIGN_UP(sizeof(PairingNode)) + data_size);
+    heap->cmp = cmp;
+    heap->next_slab = PH_SLAB_FIRST;
+
+    return heap;
+}
+
+void ph_destroy(PairingHeap *heap)
+{
+    if(!heap)
+        return;
+
+    PhSlab *slab = heap->slabs;
+    while(slab)
+    {
+        PhSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+
+    free(heap);
+}
+
+PairingNode *ph_push(PairingHeap *heap, const void *data)
+{
+    if(!heap || !data)
+        return NULL;
+
+    PairingNode *node = alloc_node(heap);
+    if(!node)
+        return NULL;
+
+    node->child = NULL;
+    node->sibling = NULL;
+    node->prev = NULL;
+    memcpy(node_data(node), data, heap->data_size);
+
+    heap->root = link(heap, heap->root, node);
+    heap->num_elements++;
+
+    return node;
+}
+
+int ph_peek(PairingHeap *heap, void *dest)
+{
+    if(!heap || !dest)
+        return -1; // Invalid input
+
+    if(!heap->root)
+        return 1; // Empty heap
+
+    memcpy(dest, node_data(heap->root), heap->data_size);
+
+    return 0;
+}
+
+int ph_pop(PairingHeap *heap, void *dest)
+{
+    if(!heap)
+        return -1; // Invalid input
+
+    if(!heap->root)
+        return 1; // Empty heap
+
+    PairingNode *top = heap->root;
+    if(dest)
+        memcpy(dest, node_data(top), heap->data_size);
+
+    heap->root = merge_pairs(heap, top->child);
+    heap->num_elements--;
+    free_node(heap, top);
+
+    return 0;
+}
+
+int ph_meld(PairingHeap *dest, PairingHeap *src)
+{
+    if(!dest || !src || dest == src)
+        return -1; // Invalid input
+
+    if(dest->data_size != src->data_size || dest->cmp != src->cmp)
+        return -1; // Heaps order different elements
+
+    dest->root = link(dest, dest->root, src->root);
+    dest->num_elements += src->num_elements;
+
+    // The nodes now belong to dest, so their slabs and spare nodes do too
+    if(src->slabs)
+    {
+        if(dest->slabs_tail)
+            dest->slabs_tail->next = src->slabs;
+        else
+            dest->slabs = src->slabs;
+        dest->slabs_tail = src->slabs_tail;
+    }
+
+    if(src->free_head)
+    {
+        if(dest->free_tail)
+            dest->free_tail->sibling = src->free_head;
+        else
+            dest->free_head = src->free_head;
+        dest->free_tail = src->free_tail;
+    }
+
+    // src stays usable as an empty heap with no memory of its own
+    src->root = NULL;
+    src->num_elements = 0;
+    src->slabs = NULL;
+    src->slabs_tail = NULL;
+    src->free_head = NULL;
+    src->free_tail = NULL;
+    src->bump = NULL;
+    src->bump_end = NULL;
+
+    return 0;
+}
+
+int ph_decrease_key(PairingHeap *heap, PairingNode *node, const void *data)
+{
+    if(!heap || !node || !data)
+        return -1; // Invalid input
+
+    // The new value may not belong below the old one
+    if(heap->cmp(node_data(node), data))
+        return -1;
+
+    memcpy(node_data(node), data, heap->data_size);
+
+    if(node != heap->root)
+    {
+        cut(node);
+        heap->root = link(heap, heap->root, node);
+    }
+
+    return 0;
+}
+
+int ph_remove(PairingHeap *heap, PairingNode *node, void *dest)
+{
+    if(!heap || !node)
+        return -1; // Invalid input
+
+    if(node == heap->root)
+        return ph_pop(heap, dest);
+
+    if(dest)
+        memcpy(dest, node_data(node), heap->data_size);
+
+    // Pair up the node's children and link them back in its place
+    cut(node);
+    heap->root = link(heap, heap->root, merge_pairs(heap, node->child));
+    heap->num_elements--;
+    free_node(heap, node);
+
+    return 0;
+}
+
+void *ph_data(PairingNode *node)
+{
+    return node ? node_data(node) : NULL;
+}
+
+size_t ph_size(PairingHeap *heap)
+{
+    return heap ? heap->num_elements : 0;
+}
@@ -0,0 +1,523 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "../include/ds_parallel.h"
+
+// Smallest chunk picked when the caller passes grain == 0
+#define PAR_MIN_GRAIN 4096
+
+// Chunks per thread when the grain is picked automatically, for load balancing
+#define PAR_CHUNKS_PER_THREAD 8
+
+typedef struct ThreadPool
+{
+    pthread_t       *threads;       // worker threads; the calling thread is the last worker
+    size_t          num_workers;
+    pthread_mutex_t lock;
+    pthread_cond_t  work_ready;     // signalled when a new job is published
+    pthread_cond_t  work_done;      // signalled when the last worker finishes a job
+    pthread_mutex_t run_lock;       // serializes jobs from concurrent callers
+    void            (*task)(size_t index, void *job);
+    void            *job;
+    size_t          num_tasks;
+    atomic_size_t   next_task;      // next chunk index to hand out
+    size_t          active_workers; // workers still busy with the current job
+    unsigned long   generation;     // bumped for every job
+    int             shutdown;
+} ThreadPool;
+
+// ======================= Thread Pool ===========================
+
+static void run_tasks(ThreadPool *pool)
+{
+    size_t i;
+    while((i = atomic_fetch_add(&pool->next_task, 1)) < pool->num_tasks)
+        pool->task(i, pool->job);
+}
+
+static void *worker_main(void *arg)
+{
+    ThreadPool *pool = arg;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while(1)
+    {
+        while(pool->generation == seen && !pool->shutdown)
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+
+        if(pool->shutdown)
+            break;
+
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_tasks(pool);
+
+        pthread_mutex_lock(&pool->lock);
+        if(--pool->active_workers == 0)
+            pthread_cond_signal(&pool->work_done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+ThreadPool *tp_create(size_t nthreads)
+{
+    if(nthreads == 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = cpus > 0 ? (size_t)cpus : 1;
+    }
+
+    ThreadPool *pool = calloc(1, sizeof(ThreadPool));
+    if(!pool)
+        return NULL;
+
+    pool->threads = malloc((nthreads - 1 ? nthreads - 1 : 1) * sizeof(pthread_t));
+    if(!pool->threads)
+    {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_mutex_init(&pool->run_lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+    atomic_init(&pool->next_task, 0);
+
+    for(size_t i = 0; i + 1 < nthreads; i++)
+    {
+        if(pthread_create(&pool->threads[i], NULL, worker_main, pool) != 0)
+        {
+            tp_destroy(pool);
+            return NULL;
+        }
+        pool->num_workers++;
+    }
+
+    return pool;
+}
+
+void tp_destroy(ThreadPool *pool)
+{
+    if(!pool)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for(size_t i = 0; i < pool->num_workers; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->run_lock);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_cond_destroy(&pool->work_done);
+    free(pool->threads);
+    free(pool);
+}
+
+size_t tp_size(ThreadPool *pool)
+{
+    return pool ? pool->num_workers + 1 : 1;
+}
+
+// Run task(0 .. num_tasks - 1) on the pool and the calling thread; NULL pool runs serially
+static void tp_run(ThreadPool *pool, size_t num_tasks, void (*task)(size_t index, void *job), void *job)
+{
+    if(!pool || pool->num_workers == 0 || num_tasks < 2)
+    {
+        for(size_t i = 0; i < num_tasks; i++)
+            task(i, job);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->run_lock);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->job = job;
+    pool->num_tasks = num_tasks;
+    atomic_store(&pool->next_task, 0);
+    pool->active_workers = pool->num_workers;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_tasks(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    while(pool->active_workers > 0)
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->run_lock);
+}
+
+// ======================= Chunking ===========================
+
+typedef struct
+{
+    size_t  n;
+    size_t  grain;
+    size_t  num_chunks;
+} Chunks;
+
+static Chunks make_chunks(ThreadPool *pool, size_t n, size_t grain)
+{
+    Chunks c = { .n = n, .grain = grain };
+
+    if(c.grain == 0)
+    {
+        size_t parts = tp_size(pool) * PAR_CHUNKS_PER_THREAD;
+        c.grain = (n + parts - 1) / parts;
+        if(c.grain < PAR_MIN_GRAIN)
+            c.grain = PAR_MIN_GRAIN;
+    }
+
+    c.num_chunks = n == 0 ? 0 : (n - 1) / c.grain + 1;
+
+    return c;
+}
+
+static size_t chunk_begin(const Chunks *c, size_t index)
+{
+    return index * c->grain;
+}
+
+static size_t chunk_end(const Chunks *c, size_t index)
+{
+    size_t end = (index + 1) * c->grain;
+    return end < c->n ? end : c->n;
+}
+
+// ======================= Algorithms ===========================
+
+typedef struct
+{
+    Chunks          chunks;
+    const uint8_t   *src;
+    uint8_t         *dst;
+    size_t          src_size;
+    size_t          dst_size;
+    void            *ctx;
+    ParForEachFunc  for_each;
+    ParMapFunc      map;
+    ParPredFunc     pred;
+    ParCombineFunc  combine;
+    const void      *identity;
+    uint8_t         *flags;         // filter: predicate result per element
+    size_t          *offsets;       // filter: output position per chunk
+    uint8_t         *partials;      // reduce / scan: one accumulator per chunk
+    uint8_t         *temps;         // scan: one element of scratch per chunk
+    int             inclusive;
+} ParJob;
+
+static void for_each_task(size_t index, void *arg)
+{
+    ParJob *job = arg;
+    uint8_t *arr = (uint8_t *)job->src;
+
+    for(size_t i = chunk_begin(&job->chunks, index); i < chunk_end(&job->chunks, index); i++)
+        job->for_each(arr + i * job->src_size, job->ctx);
+}
+
+int par_for_each(ThreadPool *pool, void *arr, size_t n, size_t data_size, size_t grain,
+                 ParForEachFunc fn, void *ctx)
+{
+    if((!arr && n > 0) || data_size == 0 || !fn)
+        return -1; // Invalid input
+
+    ParJob job = { .chunks = make_chunks(pool, n, grain), .src = arr, .src_size = data_size,
+                   .for_each = fn, .ctx = ctx };
+
+    tp_run(pool, job.chunks.num_chunks, for_each_task, &job);
+
+    return 0;
+}
+
+static void map_task(size_t index, void *arg)
+{
+    ParJob *job = arg;
+
+    for(size_t i = chunk_begin(&job->chunks, index); i < chunk_end(&job->chunks, index); i++)
+        job->map(job->src + i * job->src_size, job->dst + i * job->dst_size, job->ctx);
+}
+
+int par_map(ThreadPool *pool, const void *src, size_t n, size_t src_size, void *dst, size_t dst_size,
+            size_t grain, ParMapFunc fn, void *ctx)
+{
+    if(((!src || !dst) && n > 0) || src_size == 0 || dst_size == 0 || !fn)
+        return -1; // Invalid input
+
+    ParJob job = { .chunks = make_chunks(pool, n, grain), .src = src, .dst = dst,
+                   .src_size = src_size, .dst_size = dst_size, .map = fn, .ctx = ctx };
+
+    tp_run(pool, job.chunks.num_chunks, map_task, &job);
+
+    return 0;
+}
+
+static void filter_count_task(size_t index, void *arg)
+{
+    ParJob *job = arg;
+    size_t count = 0;
+
+    for(size_t i = chunk_begin(&job->chunks, index); i < chunk_end(&job->chunks, index); i++)
+    {
+        job->flags[i] = job->pred(job->src + i * job->src_size, job->ctx) != 0;
+        count += job->flags[i];
+    }
+
+    job->offsets[index] = count;
+}
+
+static void filter_copy_task(size_t index, void *arg)
+{
+    ParJob *job = arg;
+    uint8_t *out = job->dst + job->offsets[index] * job->src_size;
+
+    for(size_t i = chunk_begin(&job->chunks, index); i < chunk_end(&job->chunks, index); i++)
+    {
+        if(job->flags[i])
+        {
+            memcpy(out, job->src + i * job->src_size, job->src_size);
+            out += job->src_size;
+        }
+    }
+}
+
+int par_filter(ThreadPool *pool, const void *src, size_t n, size_t data_size, void *dst, size_t *count,
+               size_t grain, ParPredFunc pred, void *ctx)
+{
+    if(((!src || !dst) && n > 0) || data_size == 0 || !count || !pred)
+        return -1; // Invalid input
+
+    ParJob job = { .chunks = make_chunks(pool, n, grain), .src = src, .dst = dst,
+                   .src_size = data_size, .pred = pred, .ctx = ctx };
+
+    job.flags = malloc(n ? n : 1);
+    job.offsets = malloc((job.chunks.num_chunks ? job.chunks.num_chunks : 1) * sizeof(size_t));
+    if(!job.flags || !job.offsets)
+    {
+        free(job.flags);
+        free(job.offsets);
+        return -2; // Allocation failed
+    }
+
+    // Count survivors per chunk, turn the counts into output offsets, then compact
+    tp_run(pool, job.chunks.num_chunks, filter_count_task, &job);
+
+    size_t total = 0;
+    for(size_t c = 0; c < job.chunks.num_chunks; c++)
+    {
+        size_t chunk_count = job.offsets[c];
+        job.offsets[c] = total;
+        total += chunk_count;
+    }
+
+    tp_run(pool, job.chunks.num_chunks, filter_copy_task, &job);
+
+    *count = total;
+
+    free(job.flags);
+    free(job.offsets);
+
+    return 0;
+}
+
+static void reduce_task(size_t index, void *arg)
+{
+    ParJob *job = arg;
+    uint8_t *acc = job->partials + index * job->src_size;
+
+    memcpy(acc, job->identity, job->src_size);
+    for(size_t i = chunk_begin(&job->chunks, index); i < chunk_end(&job->chunks, index); i++)
+        job->combine(acc, job->src + i * job->src_size, job->ctx);
+}
+
+int par_reduce(ThreadPool *pool, const void *arr, size_t n, size_t data_size, size_t grain,
+               const void *identity, ParCombineFunc combine, void *ctx, void *result)
+{
+    if((!arr && n > 0) || data_size == 0 || !identity || !combine || !result)
+        return -1; // Invalid input
+
+    ParJob job = { .chunks = make_chunks(pool, n, grain), .src = arr, .src_size = data_size,
+                   .combine = combine, .identity = identity, .ctx = ctx };
+
+    job.partials = malloc((job.chunks.num_chunks ? job.chunks.num_chunks : 1) * data_size);
+    if(!job.partials)
+        return -2; // Allocation failed
+
+    tp_run(pool, job.chunks.num_chunks, reduce_task, &job);
+
+    // Combine the per-chunk results in order, so the combiner need not be commutative
+    memmove(result, identity, data_size);
+    for(size_t c = 0; c < job.chunks.num_chunks; c++)
+        combine(result, job.partials + c * data_size, ctx);
+
+    free(job.partials);
+
+    return 0;
+}
+
+static void scan_task(size_t index, void *arg)
+{
+    ParJob *job = arg;
+    size_t data_size = job->src_size;
+    uint8_t *acc = job->partials + index * data_size;
+    uint8_t *temp = job->temps + index * data_size;
+
+    for(size_t i = chunk_begin(&job->chunks, index); i < chunk_end(&job->chunks, index); i++)
+    {
+        const uint8_t *in = job->src + i * data_size;
+        uint8_t *out = job->dst + i * data_size;
+
+        if(job->inclusive)
+        {
+            job->combine(acc, in, job->ctx);
+            memcpy(out, acc, data_size);
+        }
+        else
+        {
+            // Keep the input before it is overwritten when scanning in place
+            memcpy(temp, in, data_size);
+            memcpy(out, acc, data_size);
+            job->combine(acc, temp, job->ctx);
+        }
+    }
+}
+
+int par_scan(ThreadPool *pool, const void *src, void *dst, size_t n, size_t data_size, size_t grain,
+             const void *identity, ParCombineFunc combine, void *ctx, int inclusive)
+{
+    if(((!src || !dst) && n > 0) || data_size == 0 || !identity || !combine)
+        return -1; // Invalid input
+
+    ParJob job = { .chunks = make_chunks(pool, n, grain), .src = src, .dst = dst, .src_size = data_size,
+                   .combine = combine, .identity = identity, .ctx = ctx, .inclusive = inclusive };
+
+    size_t slots = job.chunks.num_chunks ? job.chunks.num_chunks : 1;
+    job.partials = malloc(slots * data_size);
+    job.temps = malloc(slots * data_size);
+    if(!job.partials || !job.temps)
+    {
+        free(job.partials);
+        free(job.temps);
+        return -2; // Allocation failed
+    }
+
+    // Pass 1: total of every chunk
+    tp_run(pool, job.chunks.num_chunks, reduce_task, &job);
+
+    // Exclusive scan of the chunk totals gives each chunk its starting value;
+    // the per-chunk scratch is unused until pass 2, so borrow two of its slots
+    uint8_t *running = job.temps;
+    uint8_t *total = slots > 1 ? job.temps + data_size : NULL;
+
+    memcpy(running, identity, data_size);
+    for(size_t c = 0; c < job.chunks.num_chunks; c++)
+    {
+        uint8_t *partial = job.partials + c * data_size;
+
+        if(total)
+        {
+            memcpy(total, partial, data_size);
+            memcpy(partial, running, data_size);
+            combine(running, total, ctx);
+        }
+        else
+        {
+            memcpy(partial, running, data_size); // single chunk: its start is the identity
+        }
+    }
+
+    // Pass 2: scan every chunk from its starting value
+    tp_run(pool, job.chunks.num_chunks, scan_task, &job);
+
+    free(job.partials);
+    free(job.temps);
+
+    return 0;
+}
+
+// ======================= Vectors ===========================
+
+int v_par_for_each(ThreadPool *pool, Vector *vec, size_t grain, ParForEachFunc fn, void *ctx)
+{
+    if(!vec)
+        return -1; // Invalid input
+
+    size_t n;
+    void *data = v_data(vec, &n);
+
+    return par_for_each(pool, data, n, v_data_size(vec), grain, fn, ctx);
+}
+
+int v_par_map(ThreadPool *pool, Vector *src, Vector *dst, size_t grain, ParMapFunc fn, void *ctx)
+{
+    if(!src || !dst || src == dst || !fn)
+        return -1; // Invalid input
+
+    size_t n = v_size(src);
+    if(v_set_size(dst, n))
+        return -2; // Allocation failed
+
+    return par_map(pool, v_data(src, NULL), n, v_data_size(src), v_data(dst, NULL), v_data_size(dst),
+                   grain, fn, ctx);
+}
+
+int v_par_filter(ThreadPool *pool, Vector *src, Vector *dst, size_t grain, ParPredFunc pred, void *ctx)
+{
+    if(!src || !dst || src == dst || !pred || v_data_size(src) != v_data_size(dst))
+        return -1; // Invalid input
+
+    size_t n = v_size(src);
+    size_t count = 0;
+
+    // Size for the worst case, then trim to the survivors
+    if(v_set_size(dst, n))
+        return -2; // Allocation failed
+
+    int status = par_filter(pool, v_data(src, NULL), n, v_data_size(src), v_data(dst, NULL), &count,
+                            grain, pred, ctx);
+
+    v_set_size(dst, status == 0 ? count : 0);
+
+    return status;
+}
+
+int v_par_reduce(ThreadPool *pool, Vector *vec, size_t grain, const void *identity,
+                 ParCombineFunc combine, void *ctx, void *result)
+{
+    if(!vec)
+        return -1; // Invalid input
+
+    size_t n;
+    void *data = v_data(vec, &n);
+
+    return par_reduce(pool, data, n, v_data_size(vec), grain, identity, combine, ctx, result);
+}
+
+int v_par_scan(ThreadPool *pool, Vector *src, Vector *dst, size_t grain, const void *identity,
+               ParCombineFunc combine, void *ctx, int inclusive)
+{
+    if(!src || !dst || v_data_size(src) != v_data_size(dst))
+        return -1; // Invalid input
+
+    size_t n = v_size(src);
+    if(dst != src && v_set_size(dst, n))
+        return -2; // Allocation failed
+
+    return par_scan(pool, v_data(src, NULL), v_data(dst, NULL), n, v_data_size(src), grain,
+                    identity, combine, ctx, inclusive);
+}
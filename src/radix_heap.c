@@ -0,0 +1,223 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/ds_radix_heap.h"
+#include "../include/ds_vector.h"
+
+// Entries per bucket allocated up front
+#define RH_BUCKET_CAPACITY 16
+
+typedef struct RadixHeap
+{
+    Vector      *buckets[65];   // bucket i: keys whose highest bit differing from last is bit i - 1
+    size_t      num_buckets;    // key_bits + 1
+    size_t      key_size;       // bytes of the key at the start of each entry: 4 or 8
+    size_t      value_size;
+    uint64_t    last;           // last popped key; no smaller key may be pushed
+    size_t      num_elements;
+} RadixHeap;
+
+// ======================= Helper Functions ===========================
+
+static size_t bucket_of(uint64_t key, uint64_t last)
+{
+    uint64_t diff = key ^ last;
+    return diff ? 64 - (size_t)__builtin_clzll(diff) : 0;
+}
+
+static uint64_t entry_key(RadixHeap *heap, const uint8_t *entry)
+{
+    if(heap->key_size == sizeof(uint32_t))
+    {
+        uint32_t key;
+        memcpy(&key, entry, sizeof(key));
+        return key;
+    }
+
+    uint64_t key;
+    memcpy(&key, entry, sizeof(key));
+    return key;
+}
+
+static int append(RadixHeap *heap, uint64_t key, const void *value)
+{
+    uint8_t *entry = v_emplace_back(heap->buckets[bucket_of(key, heap->last)]);
+    if(!entry)
+        return -2; // Allocation failed
+
+    if(heap->key_size == sizeof(uint32_t))
+    {
+        uint32_t k = (uint32_t)key;
+        memcpy(entry, &k, sizeof(k));
+    }
+    else
+        memcpy(entry, &key, sizeof(key));
+
+    if(heap->value_size)
+        memcpy(entry + heap->key_size, value, heap->value_size);
+
+    return 0;
+}
+
+// Make sure bucket 0 holds the minimum: take the first non-empty bucket, move
+// last up to its smallest key and spread its entries over the lower buckets
+static int settle(RadixHeap *heap)
+{
+    if(v_size(heap->buckets[0]) > 0)
+        return 0;
+
+    size_t b = 1;
+    while(v_size(heap->buckets[b]) == 0)
+        b++;
+
+    size_t count;
+    size_t entry_size = heap->key_size + heap->value_size;
+    uint8_t *entries = v_data(heap->buckets[b], &count);
+
+    uint64_t min = entry_key(heap, entries);
+    for(size_t i = 1; i < count; i++)
+    {
+        uint64_t key = entry_key(heap, entries + i * entry_size);
+        min = key < min ? key : min;
+    }
+
+    // Reserve first so a failed allocation leaves the heap as it was
+    size_t targets[65] = { 0 };
+    for(size_t i = 0; i < count; i++)
+        targets[bucket_of(entry_key(heap, entries + i * entry_size), min)]++;
+
+    for(size_t i = 0; i < b; i++)
+    {
+        if(targets[i] && v_reserve(heap->buckets[i], v_size(heap->buckets[i]) + targets[i]))
+            return -2; // Allocation failed
+    }
+
+    heap->last = min;
+
+    // Every entry lands in a bucket below b, so the source stays put while we copy
+    for(size_t i = 0; i < count; i++)
+    {
+        uint8_t *entry = entries + i * entry_size;
+        memcpy(v_emplace_back(heap->buckets[bucket_of(entry_key(heap, entry), min)]), entry, entry_size);
+    }
+
+    v_set_size(heap->buckets[b], 0);
+
+    return 0;
+}
+
+// ============================= PRIMARY FUNCTIONS ====================================
+
+RadixHeap *rh_create(unsigned key_bits, size_t value_size)
+{
+    if(key_bits != 32 && key_bits != 64)
+        return NULL;
+
+    RadixHeap *heap = calloc(1, sizeof(RadixHeap));
+    if(!heap)
+        return NULL;
+
+    heap->num_buckets = key_bits + 1;
+    heap->key_size = key_bits / 8;
+    heap->value_size = value_size;
+
+    for(size_t i = 0; i < heap->num_buckets; i++)
+    {
+        heap->buckets[i] = vec_create(RH_BUCKET_CAPACITY, heap->key_size + value_size);
+        if(!heap->buckets[i])
+        {
+            rh_destroy(heap);
+            return NULL;
+        }
+    }
+
+    return heap;
+}
+
+void rh_destroy(RadixHeap *heap)
+{
+    if(!heap)
+        return;
+
+    for(size_t i = 0; i < heap->num_buckets; i++)
+        vec_destroy(heap->buckets[i]);
+
+    free(heap);
+}
+
+int rh_push(RadixHeap *heap, uint64_t key, const void *value)
+{
+    if(!heap || (heap->value_size && !value))
+        return -1; // Invalid input
+
+    if(key < heap->last)
+        return -1; // Keys must not go below the last popped key
+
+    if(heap->key_size == sizeof(uint32_t) && key > UINT32_MAX)
+        return -1; // Key does not fit in 32 bits
+
+    if(append(heap, key, value))
+        return -2; // Allocation failed
+
+    heap->num_elements++;
+
+    return 0;
+}
+
+int rh_peek(RadixHeap *heap, uint64_t *key, void *value)
+{
+    if(!heap)
+        return -1; // Invalid input
+
+    if(heap->num_elements == 0)
+        return 1; // Empty heap
+
+    if(settle(heap))
+        return -2; // Allocation failed
+
+    // Every entry in bucket 0 has key == last
+    uint8_t *entry = v_back(heap->buckets[0]);
+    if(key)
+        *key = heap->last;
+    if(value && heap->value_size)
+        memcpy(value, entry + heap->key_size, heap->value_size);
+
+    return 0;
+}
+
+int rh_pop(RadixHeap *heap, uint64_t *key, void *value)
+{
+    int status = rh_peek(heap, key, value);
+    if(status)
+        return status;
+
+    v_pop_back(heap->buckets[0]);
+    heap->num_elements--;
+
+    return 0;
+}
+
+uint64_t rh_last_key(RadixHeap *heap)
+{
+    return heap ? heap->last : 0;
+}
+
+size_t rh_size(RadixHeap *heap)
+{
+    return heap ? heap->num_elements : 0;
+}
+
+int rh_clear(RadixHeap *heap)
+{
+    if(!heap)
+        return -1; // Invalid input
+
+    for(size_t i = 0; i < heap->num_buckets; i++)
+        v_set_size(heap->buckets[i], 0);
+
+    heap->last = 0;
+    heap->num_elements = 0;
+
+    return 0;
+}
@@ -0,0 +1,259 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/ds_seg_vector.h"
+
+// Segment k holds first << (k - 1) elements (first for k == 0), so 64 segments cover any index
+#define SV_MAX_SEGMENTS 64
+
+typedef struct SegVector
+{
+    uint8_t *segments[SV_MAX_SEGMENTS];
+    size_t  num_segments;       // allocated segments
+    size_t  first_shift;        // first segment holds 1 << first_shift elements
+    size_t  data_size;
+    size_t  num_elements;
+} SegVector;
+
+// ======================= Helper Functions ===========================
+
+// Number of significant bits in x, 0 for x == 0
+static size_t bit_width(size_t x)
+{
+#if defined(__GNUC__)
+    return x ? (sizeof(unsigned long long) * 8) - (size_t)__builtin_clzll(x) : 0;
+#else
+    size_t width = 0;
+    while(x)
+    {
+        width++;
+        x >>= 1;
+    }
+    return width;
+#endif
+}
+
+static size_t segment_of(const SegVector *sv, size_t index)
+{
+    return bit_width(index >> sv->first_shift);
+}
+
+static size_t segment_start(const SegVector *sv, size_t segment)
+{
+    return segment ? (size_t)1 << (sv->first_shift + segment - 1) : 0;
+}
+
+static size_t segment_length(const SegVector *sv, size_t segment)
+{
+    return (size_t)1 << (sv->first_shift + (segment ? segment - 1 : 0));
+}
+
+static size_t capacity_of(const SegVector *sv, size_t num_segments)
+{
+    return num_segments ? (size_t)1 << (sv->first_shift + num_segments - 1) : 0;
+}
+
+static uint8_t *element_at(const SegVector *sv, size_t index)
+{
+    size_t segment = segment_of(sv, index);
+
+    return sv->segments[segment] + (index - segment_start(sv, segment)) * sv->data_size;
+}
+
+// Allocate segments until the capacity reaches min_capacity; existing segments never move
+static int grow(SegVector *sv, size_t min_capacity)
+{
+    while(capacity_of(sv, sv->num_segments) < min_capacity)
+    {
+        if(sv->first_shift + sv->num_segments >= SV_MAX_SEGMENTS)
+            return -2; // Index space exhausted
+
+        size_t length = segment_length(sv, sv->num_segments);
+        if(length > SIZE_MAX / sv->data_size)
+            return -2; // Size overflow
+
+        uint8_t *segment = malloc(length * sv->data_size);
+        if(!segment)
+            return -2; // Allocation failed
+
+        sv->segments[sv->num_segments++] = segment;
+    }
+
+    return 0;
+}
+
+// ======================= Public Functions ===========================
+
+SegVector *sv_create(size_t first_segment, size_t data_size)
+{
+    if(data_size == 0)
+        return NULL;
+
+    SegVector *sv = calloc(1, sizeof(SegVector));
+    if(!sv)
+        return NULL;
+
+    // Round the first segment up to a power of two so index math is a bit-scan
+    sv->data_size = data_size;
+    while(((size_t)1 << sv->first_shift) < first_segment && sv->first_shift < SV_MAX_SEGMENTS - 2)
+        sv->first_shift++;
+
+    return sv;
+}
+
+void sv_destroy(SegVector *sv)
+{
+    if(!sv)
+        return;
+
+    for(size_t i = 0; i < sv->num_segments; i++)
+        free(sv->segments[i]);
+
+    free(sv);
+}
+
+void *sv_emplace_back(SegVector *sv)
+{
+    if(!sv)
+        return NULL;
+
+    if(grow(sv, sv->num_elements + 1))
+        return NULL; // Error allocating segment
+
+    return element_at(sv, sv->num_elements++);
+}
+
+int sv_push_back(SegVector *sv, void *data)
+{
+    if(!sv || !data)
+        return -1; // Indicate wrong input
+
+    void *slot = sv_emplace_back(sv);
+    if(!slot)
+        return -2; // Indicate error allocating segment
+
+    memcpy(slot, data, sv->data_size);
+
+    return 0;
+}
+
+int sv_pop_back(SegVector *sv)
+{
+    if(!sv)
+        return -1; // Indicate wrong input
+
+    if(sv->num_elements == 0)
+        return 1; // Indicate empty vector
+
+    sv->num_elements--;
+
+    return 0;
+}
+
+int sv_top(SegVector *sv, void *dest)
+{
+    if(!sv || !dest)
+        return -1;
+
+    if(sv->num_elements == 0)
+        return 1;
+
+    memcpy(dest, element_at(sv, sv->num_elements - 1), sv->data_size);
+
+    return 0;
+}
+
+int sv_get(SegVector *sv, void *dest, size_t index)
+{
+    if(!sv || !dest)
+        return -1;
+
+    if(index >= sv->num_elements)
+        return -2; // Indicate index out of bounds
+
+    memcpy(dest, element_at(sv, index), sv->data_size);
+
+    return 0;
+}
+
+int sv_set(SegVector *sv, void *data, size_t index)
+{
+    if(!sv || !data)
+        return -1;
+
+    if(index >= sv->num_elements)
+        return -2; // Index is out of bounds
+
+    memcpy(element_at(sv, index), data, sv->data_size);
+
+    return 0;
+}
+
+void *sv_at(SegVector *sv, size_t index)
+{
+    if(!sv || index >= sv->num_elements)
+        return NULL; // Invalid input or index out of bounds
+
+    return element_at(sv, index);
+}
+
+void *sv_segment(SegVector *sv, size_t segment, size_t *count)
+{
+    if(!sv || segment >= sv->num_segments || segment_start(sv, segment) >= sv->num_elements)
+        return NULL;
+
+    if(count)
+    {
+        size_t left = sv->num_elements - segment_start(sv, segment);
+        size_t length = segment_length(sv, segment);
+        *count = left < length ? left : length;
+    }
+
+    return sv->segments[segment];
+}
+
+size_t sv_size(SegVector *sv)
+{
+    return sv ? sv->num_elements : 0;
+}
+
+size_t sv_capacity(SegVector *sv)
+{
+    return sv ? capacity_of(sv, sv->num_segments) : 0;
+}
+
+int sv_empty(SegVector *sv)
+{
+    return !sv || sv->num_elements == 0;
+}
+
+int sv_clear(SegVector *sv)
+{
+    if(!sv)
+        return -1;
+
+    sv->num_elements = 0;
+
+    return 0;
+}
+
+int sv_reserve(SegVector *sv, size_t capacity)
+{
+    if(!sv)
+        return -1; // Invalid input
+
+    return grow(sv, capacity);
+}
+
+int sv_shrink_to_fit(SegVector *sv)
+{
+    if(!sv)
+        return -1; // Invalid input
+
+    // Free whole segments past the last element; live elements never move
+    while(sv->num_segments > 0 && capacity_of(sv, sv->num_segments - 1) >= sv->num_elements)
+        free(sv->segments[--sv->num_segments]);
+
+    return 0;
+}
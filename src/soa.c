@@ -0,0 +1,316 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/ds_soa.h"
+
+// Columns start on a cache line boundary
+#define SOA_ALIGNMENT 64
+
+typedef struct SoaVector
+{
+    SoaField    *fields;
+    uint8_t     **columns;      // one aligned array per field
+    size_t      num_fields;
+    size_t      record_size;
+    size_t      num_rows;
+    size_t      capacity;
+} SoaVector;
+
+// ======================= Helper Functions ===========================
+
+static void *column_alloc(size_t bytes)
+{
+    // aligned_alloc requires a size that is a multiple of the alignment
+    size_t rounded = (bytes + SOA_ALIGNMENT - 1) / SOA_ALIGNMENT * SOA_ALIGNMENT;
+
+    return aligned_alloc(SOA_ALIGNMENT, rounded ? rounded : SOA_ALIGNMENT);
+}
+
+// Reallocate every column to hold exactly new_capacity rows; realloc would lose the alignment
+static int set_capacity(SoaVector *soa, size_t new_capacity)
+{
+    uint8_t **fresh = calloc(soa->num_fields, sizeof(uint8_t *));
+    if(!fresh)
+        return -2; // Allocation failed
+
+    for(size_t f = 0; f < soa->num_fields; f++)
+    {
+        if(soa->fields[f].size && new_capacity > SIZE_MAX / soa->fields[f].size)
+            fresh[f] = NULL;
+        else
+            fresh[f] = column_alloc(new_capacity * soa->fields[f].size);
+
+        if(!fresh[f])
+        {
+            for(size_t g = 0; g < f; g++)
+                free(fresh[g]);
+            free(fresh);
+            return -2; // Allocation failed
+        }
+    }
+
+    for(size_t f = 0; f < soa->num_fields; f++)
+    {
+        if(soa->columns[f])
+            memcpy(fresh[f], soa->columns[f], soa->num_rows * soa->fields[f].size);
+        free(soa->columns[f]);
+    }
+
+    free(soa->columns);
+    soa->columns = fresh;
+    soa->capacity = new_capacity;
+
+    return 0;
+}
+
+static int grow(SoaVector *soa, size_t min_capacity)
+{
+    if(min_capacity <= soa->capacity)
+        return 0;
+
+    size_t new_capacity = soa->capacity ? soa->capacity * 2 : 16;
+    while(new_capacity < min_capacity)
+        new_capacity = new_capacity > SIZE_MAX / 2 ? min_capacity : new_capacity * 2;
+
+    return set_capacity(soa, new_capacity);
+}
+
+static void scatter_row(SoaVector *soa, const uint8_t *record, size_t row)
+{
+    for(size_t f = 0; f < soa->num_fields; f++)
+    {
+        size_t size = soa->fields[f].size;
+        memcpy(soa->columns[f] + row * size, record + soa->fields[f].offset, size);
+    }
+}
+
+// Stable merge sort of row indices by one column, bottom-up with a scratch array
+static void sort_indices(size_t *idx, size_t *tmp, size_t n, const uint8_t *column, size_t size,
+                         int (*cmp)(void *a, void *b))
+{
+    for(size_t width = 1; width < n; width *= 2)
+    {
+        for(size_t lo = 0; lo < n; lo += 2 * width)
+        {
+            size_t mid = lo + width < n ? lo + width : n;
+            size_t hi = lo + 2 * width < n ? lo + 2 * width : n;
+            size_t i = lo, j = mid, k = lo;
+
+            while(i < mid && j < hi)
+            {
+                // Take from the right run only when strictly smaller, keeping equal keys in order
+                if(cmp((void *)(column + idx[j] * size), (void *)(column + idx[i] * size)) < 0)
+                    tmp[k++] = idx[j++];
+                else
+                    tmp[k++] = idx[i++];
+            }
+            while(i < mid)
+                tmp[k++] = idx[i++];
+            while(j < hi)
+                tmp[k++] = idx[j++];
+        }
+
+        memcpy(idx, tmp, n * sizeof(size_t));
+    }
+}
+
+// ======================= Public Functions ===========================
+
+SoaVector *soa_create(const SoaField *fields, size_t num_fields, size_t record_size, size_t capacity)
+{
+    if(!fields || num_fields == 0 || record_size == 0)
+        return NULL;
+
+    for(size_t f = 0; f < num_fields; f++)
+    {
+        if(fields[f].size == 0 || fields[f].offset > record_size || fields[f].size > record_size - fields[f].offset)
+            return NULL; // Field does not fit inside the record
+    }
+
+    SoaVector *soa = calloc(1, sizeof(SoaVector));
+    if(!soa)
+        return NULL;
+
+    soa->fields = malloc(num_fields * sizeof(SoaField));
+    soa->columns = calloc(num_fields, sizeof(uint8_t *));
+    if(!soa->fields || !soa->columns)
+    {
+        free(soa->fields);
+        free(soa->columns);
+        free(soa);
+        return NULL;
+    }
+
+    memcpy(soa->fields, fields, num_fields * sizeof(SoaField));
+    soa->num_fields = num_fields;
+    soa->record_size = record_size;
+
+    if(set_capacity(soa, capacity ? capacity : 16))
+    {
+        soa_destroy(soa);
+        return NULL;
+    }
+
+    return soa;
+}
+
+void soa_destroy(SoaVector *soa)
+{
+    if(!soa)
+        return;
+
+    for(size_t f = 0; f < soa->num_fields; f++)
+        free(soa->columns[f]);
+
+    free(soa->columns);
+    free(soa->fields);
+    free(soa);
+}
+
+int soa_append_rows(SoaVector *soa, const void *records, size_t count)
+{
+    if(!soa || (!records && count > 0))
+        return -1; // Invalid input
+
+    if(soa->num_rows + count < count || grow(soa, soa->num_rows + count))
+        return -2; // Allocation failed
+
+    const uint8_t *record = records;
+    for(size_t i = 0; i < count; i++, record += soa->record_size)
+        scatter_row(soa, record, soa->num_rows + i);
+
+    soa->num_rows += count;
+
+    return 0;
+}
+
+int soa_push_row(SoaVector *soa, const void *record)
+{
+    if(!soa || !record)
+        return -1; // Invalid input
+
+    return soa_append_rows(soa, record, 1);
+}
+
+int soa_get_row(SoaVector *soa, void *record, size_t index)
+{
+    if(!soa || !record)
+        return -1; // Invalid input
+
+    if(index >= soa->num_rows)
+        return -2; // Index out of bounds
+
+    // Bytes of the record not covered by a field are left untouched
+    for(size_t f = 0; f < soa->num_fields; f++)
+    {
+        size_t size = soa->fields[f].size;
+        memcpy((uint8_t *)record + soa->fields[f].offset, soa->columns[f] + index * size, size);
+    }
+
+    return 0;
+}
+
+int soa_set_row(SoaVector *soa, const void *record, size_t index)
+{
+    if(!soa || !record)
+        return -1; // Invalid input
+
+    if(index >= soa->num_rows)
+        return -2; // Index out of bounds
+
+    scatter_row(soa, record, index);
+
+    return 0;
+}
+
+void *soa_column(SoaVector *soa, size_t field, size_t *count)
+{
+    if(!soa || field >= soa->num_fields)
+        return NULL;
+
+    if(count)
+        *count = soa->num_rows;
+
+    return soa->columns[field];
+}
+
+int soa_sort_by(SoaVector *soa, size_t field, int (*cmp)(void *a, void *b))
+{
+    if(!soa || field >= soa->num_fields || !cmp)
+        return -1; // Invalid input
+
+    size_t n = soa->num_rows;
+    if(n < 2)
+        return 0;
+
+    size_t max_size = 0;
+    for(size_t f = 0; f < soa->num_fields; f++)
+        if(soa->fields[f].size > max_size)
+            max_size = soa->fields[f].size;
+
+    size_t *idx = malloc(n * sizeof(size_t));
+    size_t *tmp = malloc(n * sizeof(size_t));
+    uint8_t *scratch = malloc(n * max_size);
+    if(!idx || !tmp || !scratch)
+    {
+        free(idx);
+        free(tmp);
+        free(scratch);
+        return -2; // Allocation failed
+    }
+
+    // Sort a permutation by the key column only, then gather every column through it
+    for(size_t i = 0; i < n; i++)
+        idx[i] = i;
+
+    sort_indices(idx, tmp, n, soa->columns[field], soa->fields[field].size, cmp);
+
+    for(size_t f = 0; f < soa->num_fields; f++)
+    {
+        size_t size = soa->fields[f].size;
+        uint8_t *column = soa->columns[f];
+
+        for(size_t i = 0; i < n; i++)
+            memcpy(scratch + i * size, column + idx[i] * size, size);
+
+        memcpy(column, scratch, n * size);
+    }
+
+    free(idx);
+    free(tmp);
+    free(scratch);
+
+    return 0;
+}
+
+size_t soa_size(SoaVector *soa)
+{
+    return soa ? soa->num_rows : 0;
+}
+
+size_t soa_num_fields(SoaVector *soa)
+{
+    return soa ? soa->num_fields : 0;
+}
+
+int soa_clear(SoaVector *soa)
+{
+    if(!soa)
+        return -1; // Invalid input
+
+    soa->num_rows = 0;
+
+    return 0;
+}
+
+int soa_reserve(SoaVector *soa, size_t capacity)
+{
+    if(!soa)
+        return -1; // Invalid input
+
+    if(capacity <= soa->capacity)
+        return 0;
+
+    return set_capacity(soa, capacity);
+}
@@ -1,6 +1,15 @@
+#define _GNU_SOURCE     // mremap 
+
 #include <string.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#define VEC_HAVE_MMAP 1
+#endif
 
 #include "../include/ds_vector.h"
 
@@ -10,35 +19,201 @@ typedef struct Vector
     size_t  data_size;      // data size in bytes 
     size_t  num_elements;   // current number of elements 
     size_t  capacity;       // current capacity of the list 
+    double  growth_factor;  // capacity multiplier used when growing 
+    size_t  growth_chunk;   // fixed growth step in elements (0 = use growth_factor)
+    size_t  max_capacity;   // hard capacity limit in elements (0 = unlimited)
+    int     mmap_backed;    // vec_array is an anonymous mapping instead of a malloc block 
+    size_t  mapped_bytes;   // page-rounded length of the mapping 
 
 } Vector;
 
+#ifdef VEC_HAVE_MMAP
+// Round a byte count up to whole pages; 0 on overflow 
+static size_t page_round(size_t bytes)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    if(bytes > SIZE_MAX - page)
+        return 0;
+    return (bytes + page - 1) / page * page;
+}
+
+static void advise_huge_pages(void *addr, size_t bytes)
+{
+#ifdef MADV_HUGEPAGE
+    // Advisory only: kernels without THP simply ignore it 
+    madvise(addr, bytes, MADV_HUGEPAGE);
+#else
+    (void)addr;
+    (void)bytes;
+#endif
+}
+#endif
+
 Vector *vec_create(size_t capacity, size_t data_size)
+{
+    return vec_create_opts(capacity, data_size, NULL);
+}
+
+Vector *vec_create_opts(size_t capacity, size_t data_size, const VecOptions *opts)
 {
     if(capacity == 0 || data_size == 0)
         return NULL;
 
+    if(capacity > SIZE_MAX / data_size)
+        return NULL;
+
+    double growth_factor = 2.0;
+    size_t growth_chunk = 0;
+    size_t max_capacity = 0;
+
+    if(opts)
+    {
+        if(opts->growth_factor != 0.0 && opts->growth_factor <= 1.0)
+            return NULL; // Growth factor must actually grow the vector 
+
+        if(opts->growth_factor != 0.0)
+            growth_factor = opts->growth_factor;
+        growth_chunk = opts->growth_chunk;
+
+        if(opts->max_bytes)
+        {
+            max_capacity = opts->max_bytes / data_size;
+            if(capacity > max_capacity)
+                return NULL; // Initial capacity already exceeds the limit 
+        }
+    }
+
     Vector *new_vec = malloc(sizeof(Vector));
     if(!new_vec)
         return NULL; 
 
-    new_vec->vec_array = malloc(capacity * data_size);
-    if(!new_vec->vec_array)
+    new_vec->mmap_backed = 0;
+    new_vec->mapped_bytes = 0;
+
+#ifdef VEC_HAVE_MMAP
+    if(opts && opts->use_mmap)
     {
-        free(new_vec);
-        return NULL;
+        size_t bytes = page_round(capacity * data_size);
+        void *map = bytes ? mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) : MAP_FAILED;
+        if(map == MAP_FAILED)
+        {
+            free(new_vec);
+            return NULL;
+        }
+
+        advise_huge_pages(map, bytes);
+        new_vec->vec_array = map;
+        new_vec->mmap_backed = 1;
+        new_vec->mapped_bytes = bytes;
+    }
+    else
+#endif
+    {
+        new_vec->vec_array = malloc(capacity * data_size);
+        if(!new_vec->vec_array)
+        {
+            free(new_vec);
+            return NULL;
+        }
     }
 
     new_vec->data_size = data_size;
     new_vec->capacity = capacity;
     new_vec->num_elements = 0;
+    new_vec->growth_factor = growth_factor;
+    new_vec->growth_chunk = growth_chunk;
+    new_vec->max_capacity = max_capacity;
 
     return new_vec;
 }
 
+// Reallocate the internal array to exactly new_capacity elements 
+static int set_capacity(Vector *vec, size_t new_capacity)
+{
+    // Check for integer overflow and the memory limit 
+    if(new_capacity > SIZE_MAX / vec->data_size)
+        return -2;
+    if(vec->max_capacity && new_capacity > vec->max_capacity)
+        return -2;
+
+#ifdef VEC_HAVE_MMAP
+    if(vec->mmap_backed)
+    {
+        // mremap grows in place or moves the page tables; elements are never copied 
+        size_t bytes = page_round(new_capacity * vec->data_size);
+        if(!bytes)
+            return -2;
+
+        if(bytes != vec->mapped_bytes)
+        {
+            void *map = mremap(vec->vec_array, vec->mapped_bytes, bytes, MREMAP_MAYMOVE);
+            if(map == MAP_FAILED)
+                return -2;
+
+            if(bytes > vec->mapped_bytes)
+                advise_huge_pages(map, bytes);
+            vec->vec_array = map;
+            vec->mapped_bytes = bytes;
+        }
+
+        vec->capacity = new_capacity;
+        return 0;
+    }
+#endif
+
+    void *new_vec_array = realloc(vec->vec_array, new_capacity * vec->data_size);
+    if(!new_vec_array)
+        return -2;
+    
+    vec->vec_array = new_vec_array; 
+    vec->capacity = new_capacity; 
+
+    return 0;
+}
+
+// Grow the internal array by the growth policy so it holds at least min_capacity elements 
+static int grow(Vector *vec, size_t min_capacity)
+{
+    size_t new_capacity;
+
+    if(vec->growth_chunk)
+    {
+        new_capacity = vec->capacity > SIZE_MAX - vec->growth_chunk ? SIZE_MAX : vec->capacity + vec->growth_chunk;
+    }
+    else
+    {
+        double scaled = (double)vec->capacity * vec->growth_factor;
+        new_capacity = scaled >= (double)SIZE_MAX ? SIZE_MAX : (size_t)scaled;
+    }
+
+    if(new_capacity <= vec->capacity)
+        new_capacity = vec->capacity + 1;
+    if(new_capacity < min_capacity)
+        new_capacity = min_capacity;
+
+    // Clamp to the limits so the last steps before them still succeed 
+    if(new_capacity > SIZE_MAX / vec->data_size)
+        new_capacity = SIZE_MAX / vec->data_size;
+    if(vec->max_capacity && new_capacity > vec->max_capacity)
+        new_capacity = vec->max_capacity;
+
+    if(new_capacity < min_capacity)
+        return -2; // Limit reached 
+
+    return set_capacity(vec, new_capacity);
+}
+
 void vec_destroy(Vector *vec)
 {
-    free(vec->vec_array);
+    if(!vec)
+        return;
+
+#ifdef VEC_HAVE_MMAP
+    if(vec->mmap_backed)
+        munmap(vec->vec_array, vec->mapped_bytes);
+    else
+#endif
+        free(vec->vec_array);
     free(vec);
 }
 
@@ -47,22 +222,8 @@ int v_push_back(Vector *vec, void *data)
     if(!vec || !data)
         return -1; // Indicate wrong input  
 
-    if(vec->capacity == vec->num_elements)
-    {
-        // double vector's capacity 
-        size_t new_capacity = vec->capacity * 2;
-        
-        // Check for integer overflow 
-        if (vec->capacity > SIZE_MAX / 2 / vec->data_size)
-            return -2; // Indicate error resizing vector 
-
-        void *new_vec_array = realloc(vec->vec_array, new_capacity * vec->data_size);
-        if(!new_vec_array)
-            return -2; // Indicate error resizing vector 
-        
-        vec->vec_array = new_vec_array; 
-        vec->capacity = new_capacity; 
-    }
+    if(vec->capacity == vec->num_elements && grow(vec, vec->num_elements + 1))
+        return -2; // Indicate error resizing vector 
 
     // Copy data to internal vector array 
     memcpy((uint8_t *)vec->vec_array + vec->data_size * vec->num_elements, data, vec->data_size);
@@ -72,6 +233,18 @@ int v_push_back(Vector *vec, void *data)
     return 0;
 }   
 
+void *v_emplace_back(Vector *vec)
+{
+    if(!vec)
+        return NULL;
+
+    if(vec->capacity == vec->num_elements && grow(vec, vec->num_elements + 1))
+        return NULL; // Error resizing vector 
+
+    // Slot is left uninitialized for the caller to fill 
+    return (uint8_t *)vec->vec_array + vec->data_size * vec->num_elements++;
+}
+
 int v_pop_back(Vector *vec)
 {
     if(!vec)
@@ -112,6 +285,37 @@ int v_get(Vector *vec, void *dest, size_t index)
     return 0;
 }
 
+void *v_at(Vector *vec, size_t index)
+{
+    if(!vec || index >= vec->num_elements)
+        return NULL; // Invalid input or index out of bounds 
+
+    return (uint8_t *)vec->vec_array + index * vec->data_size;
+}
+
+void *v_back(Vector *vec)
+{
+    if(!vec || vec->num_elements == 0)
+        return NULL;
+
+    return (uint8_t *)vec->vec_array + (vec->num_elements - 1) * vec->data_size;
+}
+
+void *v_data(Vector *vec, size_t *size)
+{
+    if(!vec)
+    {
+        if(size)
+            *size = 0;
+        return NULL;
+    }
+
+    if(size)
+        *size = vec->num_elements;
+
+    return vec->vec_array;
+}
+
 int v_set(Vector *vec, void *data, size_t index)
 {
     if(!vec || !data)
@@ -135,22 +339,8 @@ int v_insert(Vector *vec, void *data, size_t index)
         return -2; // Index is out of bounds 
 
     // Resize the internal vector  
-    if(vec->num_elements + 1 > vec->capacity)
-    {
-        // double vector's capacity 
-        size_t new_capacity = vec->capacity * 2;
-        
-        // Check for integer overflow 
-        if (vec->capacity > SIZE_MAX / 2 / vec->data_size)
-            return -2; // Indicate error resizing vector 
-
-        void *new_vec_array = realloc(vec->vec_array, new_capacity * vec->data_size);
-        if(!new_vec_array)
-            return -2; // Error allocating memory 
-            
-        vec->vec_array = new_vec_array;
-        vec->capacity = new_capacity;
-    }
+    if(vec->num_elements + 1 > vec->capacity && grow(vec, vec->num_elements + 1))
+        return -2; // Error allocating memory 
 
     memmove((uint8_t *)vec->vec_array + (index + 1) * vec->data_size, 
             (uint8_t *)vec->vec_array + index * vec->data_size, 
@@ -186,6 +376,104 @@ int v_erase(Vector *vec, size_t index)
     return 0;
 }
 
+int v_append_n(Vector *vec, const void *data, size_t count)
+{
+    return v_insert_range(vec, data, count, v_size(vec));
+}
+
+int v_insert_range(Vector *vec, const void *data, size_t count, size_t index)
+{
+    if(!vec || (!data && count > 0))
+        return -1; // Incorrect input 
+
+    if(index > vec->num_elements)
+        return -2; // Index is out of bounds 
+
+    if(count == 0)
+        return 0;
+
+    if(count > SIZE_MAX - vec->num_elements)
+        return -2; // Size overflow 
+
+    // Single growth step for the whole range 
+    if(vec->num_elements + count > vec->capacity && grow(vec, vec->num_elements + count))
+        return -2; // Error allocating memory 
+
+    memmove((uint8_t *)vec->vec_array + (index + count) * vec->data_size, 
+            (uint8_t *)vec->vec_array + index * vec->data_size, 
+            (vec->num_elements - index) * vec->data_size
+           );
+
+    memcpy((uint8_t *)vec->vec_array + index * vec->data_size, data, count * vec->data_size);
+
+    vec->num_elements += count;
+
+    return 0;
+}
+
+int v_erase_range(Vector *vec, size_t index, size_t count)
+{
+    if(!vec)
+        return -1; // Incorrect input 
+
+    if(index > vec->num_elements || count > vec->num_elements - index)
+        return -2; // Range is out of bounds 
+
+    memmove((uint8_t *)vec->vec_array + index * vec->data_size, 
+            (uint8_t *)vec->vec_array + (index + count) * vec->data_size, 
+            (vec->num_elements - index - count) * vec->data_size      
+           );
+
+    vec->num_elements -= count;
+
+    return 0;
+}
+
+int v_swap_remove(Vector *vec, size_t index)
+{
+    if(!vec)
+        return -1; // Incorrect input 
+
+    if(index >= vec->num_elements)
+        return -2; // Index is out of bounds 
+
+    // Move the last element into the hole 
+    if(index != vec->num_elements - 1)
+        memcpy((uint8_t *)vec->vec_array + index * vec->data_size, 
+               (uint8_t *)vec->vec_array + (vec->num_elements - 1) * vec->data_size, 
+               vec->data_size);
+
+    vec->num_elements--;
+
+    return 0;
+}
+
+int v_remove_if(Vector *vec, int(*pred)(void *elem))
+{
+    if(!vec || !pred)
+        return -1; // Incorrect input 
+
+    uint8_t *arr = vec->vec_array;
+    size_t kept = 0;
+
+    // Compact survivors towards the front in a single pass 
+    for(size_t i = 0; i < vec->num_elements; i++)
+    {
+        uint8_t *elem = arr + i * vec->data_size;
+
+        if(pred(elem))
+            continue;
+
+        if(kept != i)
+            memcpy(arr + kept * vec->data_size, elem, vec->data_size);
+        kept++;
+    }
+
+    vec->num_elements = kept;
+
+    return 0;
+}
+
 size_t v_size(Vector *vec)
 {
     return !vec ? 0 : vec->num_elements;
@@ -196,6 +484,11 @@ size_t v_capacity(Vector *vec)
     return !vec ? 0 : vec->capacity;
 }
 
+size_t v_data_size(Vector *vec)
+{
+    return !vec ? 0 : vec->data_size;
+}
+
 int v_empty(Vector *vec)
 {
     return (!vec || vec->num_elements == 0) ? 1 : 0;
@@ -208,6 +501,12 @@ int v_clear(Vector *vec)
 
     vec->num_elements = 0; 
 
+#ifdef VEC_HAVE_MMAP
+    // Hand the physical pages back; the mapping stays reserved and refaults as zero pages 
+    if(vec->mmap_backed)
+        madvise(vec->vec_array, vec->mapped_bytes, MADV_DONTNEED);
+#endif
+
     return 0;
 }
 
@@ -216,12 +515,8 @@ int v_resize(Vector *vec, size_t new_capacity)
     if(!vec || new_capacity == 0)
         return -1; // Invalid input
 
-    void *new_array = realloc(vec->vec_array, new_capacity * vec->data_size);
-    if(!new_array)
+    if(set_capacity(vec, new_capacity))
         return -2; // Allocation failed 
-    
-    vec->vec_array = new_array;
-    vec->capacity = new_capacity;
 
     if(vec->num_elements > new_capacity)
         vec->num_elements = new_capacity;
@@ -229,85 +524,195 @@ int v_resize(Vector *vec, size_t new_capacity)
     return 0;
 }
 
-static int get_partition(uint8_t *arr, size_t data_size, int begin, int end, int(*cmp)(void *a, void *b))
+int v_set_size(Vector *vec, size_t size)
 {
-    void *pivot = malloc(data_size);
-    if(!pivot)
-        return -1;
-        
-    void *temp = malloc(data_size);
-    if(!temp)
-    {
-        free(pivot);
-        return -1;
-    }
+    if(!vec)
+        return -1; // Invalid input 
+
+    if(size > vec->capacity && grow(vec, size))
+        return -2; // Allocation failed 
+
+    // Elements past the old size are left uninitialized 
+    vec->num_elements = size;
+
+    return 0;
+}
+
+int v_reserve(Vector *vec, size_t capacity)
+{
+    if(!vec)
+        return -1; // Invalid input 
+
+    if(capacity <= vec->capacity)
+        return 0;
+
+    return set_capacity(vec, capacity);
+}
 
-    memcpy(pivot, arr + end * data_size, data_size);
+int v_shrink_to_fit(Vector *vec)
+{
+    if(!vec)
+        return -1; // Invalid input 
+
+    // Keep room for one element so the array is never zero-sized 
+    size_t new_capacity = vec->num_elements ? vec->num_elements : 1;
+    if(new_capacity == vec->capacity)
+        return 0;
 
-    int i = begin - 1; 
+    return set_capacity(vec, new_capacity);
+}
+
+// Ranges at or below this size are finished with insertion sort by intro_sort and introselect 
+#define SORT_INSERTION_THRESHOLD 16
 
-    for(int j = begin; j <= end - 1; ++j)
+// Insertion sort of n elements; temp must hold one element 
+static void insertion_sort_range(uint8_t *arr, size_t data_size, size_t n, int(*cmp)(void *a, void *b), void *temp)
+{
+    for(size_t i = 1; i < n; i++)
     {
-        if(cmp(arr + j * data_size, pivot) < 0)
+        memcpy(temp, arr + i * data_size, data_size);
+
+        size_t j = i;
+        while(j > 0 && cmp(arr + (j - 1) * data_size, temp) > 0)
         {
-            i++;
-            memcpy(temp, arr + i * data_size, data_size);
-            memcpy(arr + i * data_size, arr + j * data_size, data_size);
-            memcpy(arr + j * data_size, temp, data_size);
+            memcpy(arr + j * data_size, arr + (j - 1) * data_size, data_size);
+            j--;
         }
+        memcpy(arr + j * data_size, temp, data_size);
     }
-    
-    i++;
+}
+
+// Restore the max-heap (by cmp) below node i of an n-element heap, moving each element once 
+static void heap_sift_down(uint8_t *arr, size_t data_size, size_t n, size_t i, int(*cmp)(void *a, void *b), void *temp)
+{
     memcpy(temp, arr + i * data_size, data_size);
-    memcpy(arr + i * data_size, arr + end * data_size, data_size);
-    memcpy(arr + end * data_size, temp, data_size);
 
-    free(pivot);
-    free(temp);
+    while(1)
+    {
+        size_t child = 2 * i + 1;
+        if(child >= n)
+            break;
+        if(child + 1 < n && cmp(arr + (child + 1) * data_size, arr + child * data_size) > 0)
+            child++;
+        if(cmp(arr + child * data_size, temp) <= 0)
+            break;
+
+        memcpy(arr + i * data_size, arr + child * data_size, data_size);
+        i = child;
+    }
 
-    return i;
+    memcpy(arr + i * data_size, temp, data_size);
 }
 
-static int quick_sort(uint8_t *arr, size_t data_size, int begin, int end, int(*cmp)(void *a, void *b))
+// In-place heap sort; temp must hold two elements 
+static void heap_sort_range(uint8_t *arr, size_t data_size, size_t n, int(*cmp)(void *a, void *b), uint8_t *temp)
 {
-    if(begin >= end)
-        return 0; 
-    
-    int pivot = get_partition(arr, data_size, begin, end, cmp);
-    // Validate pivot 
-    if(pivot == -1)
-        return -1;
-    
-    // Return -1 to exit on failure 
-    if(quick_sort(arr, data_size, begin, pivot - 1, cmp))
-        return -1;
+    for(size_t i = n / 2; i-- > 0; )
+        heap_sift_down(arr, data_size, n, i, cmp, temp);
 
-    if(quick_sort(arr, data_size, pivot + 1, end, cmp) == -1)
-        return -1;
-    
-    return 0;
+    for(size_t end = n; end-- > 1; )
+    {
+        // Move the current maximum behind the heap 
+        memcpy(temp + data_size, arr + end * data_size, data_size);
+        memcpy(arr + end * data_size, arr, data_size);
+        memcpy(arr, temp + data_size, data_size);
+        heap_sift_down(arr, data_size, end, 0, cmp, temp);
+    }
 }
 
-static int insertionSort(uint8_t *arr, size_t data_size, int size, int(*cmp)(void *a, void *b))
+static void swap_elements(uint8_t *a, uint8_t *b, size_t data_size, void *temp)
 {
-    void *temp = malloc(data_size); 
-    if(!temp)
-        return -1;
+    memcpy(temp, a, data_size);
+    memcpy(a, b, data_size);
+    memcpy(b, temp, data_size);
+}
+
+// Partition [lo, hi) (at least three elements) around the median of its first, middle 
+// and last elements and return j with [lo, j] <= pivot <= [j + 1, hi), both sides non-empty. 
+// Hoare's scheme splits runs of equal keys evenly; temp must hold three elements 
+static size_t median3_partition(uint8_t *arr, size_t data_size, size_t lo, size_t hi, int(*cmp)(void *a, void *b), uint8_t *temp)
+{
+    // Order lo, mid, hi - 1 and use the median as the pivot at lo 
+    uint8_t *a = arr + lo * data_size;
+    uint8_t *m = arr + (lo + (hi - lo) / 2) * data_size;
+    uint8_t *b = arr + (hi - 1) * data_size;
+    if(cmp(m, a) < 0)
+        swap_elements(m, a, data_size, temp);
+    if(cmp(b, m) < 0)
+    {
+        swap_elements(b, m, data_size, temp);
+        if(cmp(m, a) < 0)
+            swap_elements(m, a, data_size, temp);
+    }
+    swap_elements(a, m, data_size, temp);
+
+    uint8_t *pivot = temp + 2 * data_size;
+    memcpy(pivot, a, data_size);
+
+    size_t i = lo - 1, j = hi;
+    while(1)
+    {
+        do { i++; } while(cmp(arr + i * data_size, pivot) < 0);
+        do { j--; } while(cmp(arr + j * data_size, pivot) > 0);
+        if(i >= j)
+            return j;
+        swap_elements(arr + i * data_size, arr + j * data_size, data_size, temp);
+    }
+}
+
+// Recursion budget for intro_sort and introselect: 2 * floor(log2(n)) 
+static size_t intro_depth(size_t n)
+{
+    size_t depth = 0;
+    for(size_t m = n; m > 1; m >>= 1)
+        depth += 2;
 
-    for(int i = 1; i < size; i++)
+    return depth;
+}
+
+// Introsort: quicksort with median-of-three pivots that recurses into the smaller side 
+// and loops on the larger, so the stack stays O(log n), and falls back to heap sort 
+// once depth levels are used up; temp must hold three elements 
+static void intro_sort(uint8_t *arr, size_t data_size, size_t n, size_t depth, int(*cmp)(void *a, void *b), uint8_t *temp)
+{
+    size_t lo = 0, hi = n;
+
+    while(hi - lo > SORT_INSERTION_THRESHOLD)
     {
-        memcpy(temp, arr + (i * data_size), data_size);
+        if(depth-- == 0)
+        {
+            heap_sort_range(arr + lo * data_size, data_size, hi - lo, cmp, temp);
+            return;
+        }
 
-        int j = i - 1; 
-        
-        while(j >= 0 && cmp(arr + (j * data_size), temp) > 0)
+        size_t j = median3_partition(arr, data_size, lo, hi, cmp, temp);
+
+        if(j + 1 - lo < hi - j - 1)
         {
-            memcpy(arr + ((j + 1) * data_size), arr + (j * data_size), data_size);
-            j--;
+            intro_sort(arr + lo * data_size, data_size, j + 1 - lo, depth, cmp, temp);
+            lo = j + 1;
+        }
+        else
+        {
+            intro_sort(arr + (j + 1) * data_size, data_size, hi - j - 1, depth, cmp, temp);
+            hi = j + 1;
         }
-        memcpy(arr + ((j + 1) * data_size), temp, data_size);
     }
 
+    insertion_sort_range(arr + lo * data_size, data_size, hi - lo, cmp, temp);
+}
+
+static int serial_sort(uint8_t *arr, size_t data_size, size_t size, int(*cmp)(void *a, void *b))
+{
+    if(size < 2)
+        return 0;
+
+    uint8_t *temp = malloc(3 * data_size);
+    if(!temp)
+        return -1;
+
+    intro_sort(arr, data_size, size, intro_depth(size), cmp, temp);
+
     free(temp);
 
     return 0;
@@ -318,10 +723,958 @@ int v_sort(Vector *vec, int(*cmp)(void *a, void *b))
     if(!vec || !cmp)
         return -1; // Invalid input  
     
-    if(vec->num_elements == 0)
+    return serial_sort(vec->vec_array, vec->data_size, vec->num_elements, cmp);
+}
+
+// Map a key to an unsigned integer whose natural order matches the key's order 
+static uint64_t radix_key(const uint8_t *elem, VecKeyType key_type)
+{
+    uint32_t k32;
+    uint64_t k64;
+
+    switch(key_type)
+    {
+        case V_KEY_U32:
+            memcpy(&k32, elem, sizeof(k32));
+            return k32;
+        case V_KEY_I32:
+            memcpy(&k32, elem, sizeof(k32));
+            return k32 ^ UINT32_C(0x80000000);
+        case V_KEY_F32:
+            memcpy(&k32, elem, sizeof(k32));
+            // Negative floats: flip all bits; positive floats: flip the sign bit 
+            return (k32 & UINT32_C(0x80000000)) ? ~k32 : k32 ^ UINT32_C(0x80000000);
+        case V_KEY_U64:
+            memcpy(&k64, elem, sizeof(k64));
+            return k64;
+        case V_KEY_I64:
+            memcpy(&k64, elem, sizeof(k64));
+            return k64 ^ UINT64_C(0x8000000000000000);
+        case V_KEY_F64:
+        default:
+            memcpy(&k64, elem, sizeof(k64));
+            return (k64 & UINT64_C(0x8000000000000000)) ? ~k64 : k64 ^ UINT64_C(0x8000000000000000);
+    }
+}
+
+int v_sort_radix(Vector *vec, size_t key_offset, VecKeyType key_type)
+{
+    if(!vec || key_type < V_KEY_U32 || key_type > V_KEY_F64)
+        return -1; // Invalid input 
+
+    size_t key_width = key_type <= V_KEY_F32 ? 4 : 8;
+
+    if(key_offset > vec->data_size || vec->data_size - key_offset < key_width)
+        return -1; // Key does not fit inside the element 
+
+    size_t n = vec->num_elements;
+    size_t data_size = vec->data_size;
+
+    if(n < 2)
         return 0;
-    if(vec->num_elements < 100)
-        return insertionSort(vec->vec_array, vec->data_size, vec->num_elements, cmp);
-    else    
-        return quick_sort(vec->vec_array, vec->data_size, 0, vec->num_elements - 1, cmp);
-}
\ No newline at end of file
+
+    // Histograms for every byte of the key are built in a single pass 
+    size_t hist[8][256];
+    memset(hist, 0, sizeof(hist));
+
+    uint8_t *src = vec->vec_array;
+    for(size_t i = 0; i < n; i++)
+    {
+        uint64_t key = radix_key(src + i * data_size + key_offset, key_type);
+        for(size_t b = 0; b < key_width; b++)
+            hist[b][(key >> (b * 8)) & 0xFF]++;
+    }
+
+    uint8_t *scratch = NULL;
+    uint8_t *dst = NULL;
+
+    for(size_t b = 0; b < key_width; b++)
+    {
+        // Skip the pass if every element falls into the same bucket 
+        uint64_t first_byte = (radix_key(src + key_offset, key_type) >> (b * 8)) & 0xFF;
+        if(hist[b][first_byte] == n)
+            continue;
+
+        if(!scratch)
+        {
+            scratch = malloc(n * data_size);
+            if(!scratch)
+                return -2; // Allocation failed 
+            dst = scratch;
+        }
+
+        // Exclusive prefix sum turns counts into output positions 
+        size_t offset = 0;
+        for(size_t d = 0; d < 256; d++)
+        {
+            size_t count = hist[b][d];
+            hist[b][d] = offset;
+            offset += count;
+        }
+
+        for(size_t i = 0; i < n; i++)
+        {
+            uint8_t *elem = src + i * data_size;
+            size_t digit = (radix_key(elem + key_offset, key_type) >> (b * 8)) & 0xFF;
+            memcpy(dst + hist[b][digit]++ * data_size, elem, data_size);
+        }
+
+        uint8_t *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    // Odd number of executed passes leaves the result in the scratch buffer 
+    if(src != vec->vec_array)
+        memcpy(vec->vec_array, src, n * data_size);
+
+    free(scratch);
+
+    return 0;
+}
+
+
+// Vectors smaller than this are sorted serially by v_sort_parallel 
+#define PARALLEL_SORT_THRESHOLD 65536
+
+// One unit of work for a v_sort_parallel worker thread 
+typedef struct
+{
+    uint8_t *left;          // first sorted run (or the chunk to sort)
+    size_t  left_size;
+    uint8_t *right;         // second sorted run (NULL for a chunk sort)
+    size_t  right_size;
+    uint8_t *out;           // merge output
+    size_t  out_begin;      // slice of the merged output owned by this task
+    size_t  out_end;
+    size_t  data_size;
+    int     (*cmp)(void *a, void *b);
+    int     status;
+} SortTask;
+
+// Number of elements taken from the left run among the first k merged elements 
+static size_t merge_corank(SortTask *task, size_t k)
+{
+    size_t lo = k > task->right_size ? k - task->right_size : 0;
+    size_t hi = k < task->left_size ? k : task->left_size;
+
+    while(lo < hi)
+    {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+
+        // Left wins ties, so right[j - 1] must be strictly smaller than left[i] 
+        if(j > 0 && task->cmp(task->right + (j - 1) * task->data_size, task->left + i * task->data_size) >= 0)
+            lo = i + 1;
+        else
+            hi = i;
+    }
+
+    return lo;
+}
+
+static void *sort_task_run(void *arg)
+{
+    SortTask *task = arg;
+    size_t data_size = task->data_size;
+
+    if(!task->right)
+    {
+        task->status = serial_sort(task->left, data_size, task->left_size, task->cmp);
+        return NULL;
+    }
+
+    size_t i = merge_corank(task, task->out_begin);
+    size_t j = task->out_begin - i;
+    size_t i_end = merge_corank(task, task->out_end);
+    size_t j_end = task->out_end - i_end;
+    uint8_t *out = task->out + task->out_begin * data_size;
+
+    while(i < i_end && j < j_end)
+    {
+        if(task->cmp(task->right + j * data_size, task->left + i * data_size) < 0)
+            memcpy(out, task->right + j++ * data_size, data_size);
+        else
+            memcpy(out, task->left + i++ * data_size, data_size);
+        out += data_size;
+    }
+
+    memcpy(out, task->left + i * data_size, (i_end - i) * data_size);
+    out += (i_end - i) * data_size;
+    memcpy(out, task->right + j * data_size, (j_end - j) * data_size);
+
+    task->status = 0;
+    return NULL;
+}
+
+// Run every task on its own thread; a task whose thread cannot be started runs inline 
+static int run_sort_tasks(SortTask *tasks, pthread_t *threads, int *started, size_t num_tasks)
+{
+    for(size_t t = 0; t < num_tasks; t++)
+    {
+        started[t] = pthread_create(&threads[t], NULL, sort_task_run, &tasks[t]) == 0;
+        if(!started[t])
+            sort_task_run(&tasks[t]);
+    }
+
+    int status = 0;
+    for(size_t t = 0; t < num_tasks; t++)
+    {
+        if(started[t])
+            pthread_join(threads[t], NULL);
+        if(tasks[t].status != 0)
+            status = tasks[t].status;
+    }
+
+    return status;
+}
+
+int v_sort_parallel(Vector *vec, int(*cmp)(void *a, void *b), size_t nthreads)
+{
+    if(!vec || !cmp)
+        return -1; // Invalid input 
+
+    if(nthreads == 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = cpus > 0 ? (size_t)cpus : 1;
+    }
+
+    size_t n = vec->num_elements;
+    size_t data_size = vec->data_size;
+
+    // Keep every chunk at least PARALLEL_SORT_THRESHOLD / 2 elements long 
+    if(nthreads > n / (PARALLEL_SORT_THRESHOLD / 2))
+        nthreads = n / (PARALLEL_SORT_THRESHOLD / 2);
+
+    if(n < PARALLEL_SORT_THRESHOLD || nthreads < 2)
+        return v_sort(vec, cmp);
+
+    uint8_t *scratch = malloc(n * data_size);
+    SortTask *tasks = malloc(nthreads * sizeof(SortTask));
+    pthread_t *threads = malloc(nthreads * sizeof(pthread_t));
+    int *started = malloc(nthreads * sizeof(int));
+    size_t *runs = malloc((nthreads + 1) * sizeof(size_t));
+    if(!scratch || !tasks || !threads || !started || !runs)
+    {
+        free(scratch);
+        free(tasks);
+        free(threads);
+        free(started);
+        free(runs);
+        return -2; // Allocation failed 
+    }
+
+    // Phase 1: sort nthreads contiguous chunks in place 
+    size_t num_runs = nthreads;
+    for(size_t r = 0; r <= num_runs; r++)
+        runs[r] = n / num_runs * r + (r < n % num_runs ? r : n % num_runs);
+
+    uint8_t *src = vec->vec_array;
+    uint8_t *dst = scratch;
+
+    for(size_t r = 0; r < num_runs; r++)
+    {
+        tasks[r] = (SortTask){ .left = src + runs[r] * data_size, .left_size = runs[r + 1] - runs[r],
+                               .data_size = data_size, .cmp = cmp };
+    }
+
+    int status = run_sort_tasks(tasks, threads, started, num_runs);
+
+    // Phase 2: merge pairs of runs, splitting each merge across the threads 
+    while(status == 0 && num_runs > 1)
+    {
+        size_t pairs = num_runs / 2;
+        size_t parts = nthreads / pairs;
+        size_t num_tasks = 0;
+
+        for(size_t p = 0; p < pairs; p++)
+        {
+            size_t begin = runs[2 * p];
+            size_t mid = runs[2 * p + 1];
+            size_t end = runs[2 * p + 2];
+            size_t len = end - begin;
+
+            for(size_t q = 0; q < parts; q++)
+            {
+                tasks[num_tasks++] = (SortTask){
+                    .left = src + begin * data_size, .left_size = mid - begin,
+                    .right = src + mid * data_size, .right_size = end - mid,
+                    .out = dst + begin * data_size,
+                    .out_begin = len / parts * q, .out_end = q + 1 == parts ? len : len / parts * (q + 1),
+                    .data_size = data_size, .cmp = cmp };
+            }
+        }
+
+        // An unpaired trailing run is carried over unchanged 
+        if(num_runs % 2)
+        {
+            size_t begin = runs[num_runs - 1];
+            memcpy(dst + begin * data_size, src + begin * data_size, (n - begin) * data_size);
+        }
+
+        status = run_sort_tasks(tasks, threads, started, num_tasks);
+
+        for(size_t r = 0; r <= num_runs / 2; r++)
+            runs[r] = runs[2 * r];
+        if(num_runs % 2)
+            runs[num_runs / 2 + 1] = n;
+        num_runs = (num_runs + 1) / 2;
+
+        uint8_t *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if(status == 0 && src != vec->vec_array)
+        memcpy(vec->vec_array, src, n * data_size);
+
+    free(scratch);
+    free(tasks);
+    free(threads);
+    free(started);
+    free(runs);
+
+    return status;
+}
+
+
+// Timsort-style stack depth; enough for any run lengths that fit in size_t 
+#define STABLE_SORT_MAX_RUNS 128
+
+// State of one v_stable_sort / v_argsort call 
+typedef struct
+{
+    uint8_t *arr;                   // items being sorted
+    size_t  width;                  // size of one item in bytes
+    uint8_t *records;               // when set, items are size_t indices into records
+    size_t  data_size;              // size of one record (indirect mode)
+    int     (*cmp)(void *a, void *b);
+    uint8_t *buf;                   // merge buffer
+    size_t  buf_cap;                // merge buffer capacity in items
+    uint8_t *temp;                  // single item scratch
+    size_t  run_base[STABLE_SORT_MAX_RUNS];
+    size_t  run_len[STABLE_SORT_MAX_RUNS];
+    size_t  num_runs;
+} StableSort;
+
+static int ss_cmp(StableSort *ss, uint8_t *a, uint8_t *b)
+{
+    if(!ss->records)
+        return ss->cmp(a, b);
+
+    size_t ia, ib;
+    memcpy(&ia, a, sizeof(size_t));
+    memcpy(&ib, b, sizeof(size_t));
+    return ss->cmp(ss->records + ia * ss->data_size, ss->records + ib * ss->data_size);
+}
+
+static uint8_t *ss_item(StableSort *ss, size_t index)
+{
+    return ss->arr + index * ss->width;
+}
+
+// Minimum run length: n / 2^k rounded up so that n / minrun is close to a power of two 
+static size_t ss_min_run(size_t n)
+{
+    size_t r = 0;
+    while(n >= 64)
+    {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+// Sort [lo, hi) where [lo, start) is already sorted 
+static void ss_binary_insertion(StableSort *ss, size_t lo, size_t start, size_t hi)
+{
+    for(size_t k = start; k < hi; k++)
+    {
+        memcpy(ss->temp, ss_item(ss, k), ss->width);
+
+        // First position in [lo, k) whose item is greater than temp 
+        size_t left = lo, right = k;
+        while(left < right)
+        {
+            size_t mid = left + (right - left) / 2;
+            if(ss_cmp(ss, ss->temp, ss_item(ss, mid)) < 0)
+                right = mid;
+            else
+                left = mid + 1;
+        }
+
+        memmove(ss_item(ss, left + 1), ss_item(ss, left), (k - left) * ss->width);
+        memcpy(ss_item(ss, left), ss->temp, ss->width);
+    }
+}
+
+// Length of the run starting at lo; strictly descending runs are reversed in place 
+static size_t ss_count_run(StableSort *ss, size_t lo, size_t n)
+{
+    size_t hi = lo + 1;
+    if(hi == n)
+        return 1;
+
+    if(ss_cmp(ss, ss_item(ss, hi), ss_item(ss, lo)) < 0)
+    {
+        while(hi + 1 < n && ss_cmp(ss, ss_item(ss, hi + 1), ss_item(ss, hi)) < 0)
+            hi++;
+
+        for(size_t i = lo, j = hi; i < j; i++, j--)
+        {
+            memcpy(ss->temp, ss_item(ss, i), ss->width);
+            memcpy(ss_item(ss, i), ss_item(ss, j), ss->width);
+            memcpy(ss_item(ss, j), ss->temp, ss->width);
+        }
+    }
+    else
+    {
+        while(hi + 1 < n && ss_cmp(ss, ss_item(ss, hi + 1), ss_item(ss, hi)) >= 0)
+            hi++;
+    }
+
+    return hi - lo + 1;
+}
+
+static int ss_reserve_buffer(StableSort *ss, size_t items)
+{
+    if(items <= ss->buf_cap)
+        return 0;
+
+    uint8_t *new_buf = realloc(ss->buf, items * ss->width);
+    if(!new_buf)
+        return -2;
+
+    ss->buf = new_buf;
+    ss->buf_cap = items;
+
+    return 0;
+}
+
+// Merge runs i and i + 1 of the run stack 
+static int ss_merge_at(StableSort *ss, size_t i)
+{
+    size_t base_a = ss->run_base[i], len_a = ss->run_len[i];
+    size_t base_b = ss->run_base[i + 1], len_b = ss->run_len[i + 1];
+
+    ss->run_len[i] = len_a + len_b;
+    if(i + 2 < ss->num_runs)
+    {
+        ss->run_base[i + 1] = ss->run_base[i + 2];
+        ss->run_len[i + 1] = ss->run_len[i + 2];
+    }
+    ss->num_runs--;
+
+    // Items of A not greater than B[0] are already in place 
+    size_t left = 0, right = len_a;
+    while(left < right)
+    {
+        size_t mid = left + (right - left) / 2;
+        if(ss_cmp(ss, ss_item(ss, base_b), ss_item(ss, base_a + mid)) < 0)
+            right = mid;
+        else
+            left = mid + 1;
+    }
+    base_a += left;
+    len_a -= left;
+    if(len_a == 0)
+        return 0;
+
+    // Items of B not less than the last item of A are already in place 
+    uint8_t *last_a = ss_item(ss, base_a + len_a - 1);
+    left = 0, right = len_b;
+    while(left < right)
+    {
+        size_t mid = left + (right - left) / 2;
+        if(ss_cmp(ss, ss_item(ss, base_b + mid), last_a) < 0)
+            left = mid + 1;
+        else
+            right = mid;
+    }
+    len_b = left;
+    if(len_b == 0)
+        return 0;
+
+    if(ss_reserve_buffer(ss, len_a < len_b ? len_a : len_b))
+        return -2;
+
+    size_t width = ss->width;
+
+    if(len_a <= len_b)
+    {
+        // Merge low: copy A out, fill from the front 
+        memcpy(ss->buf, ss_item(ss, base_a), len_a * width);
+
+        uint8_t *dest = ss_item(ss, base_a);
+        size_t ia = 0, ib = 0;
+        while(ia < len_a && ib < len_b)
+        {
+            if(ss_cmp(ss, ss_item(ss, base_b + ib), ss->buf + ia * width) < 0)
+                memcpy(dest, ss_item(ss, base_b + ib++), width);
+            else
+                memcpy(dest, ss->buf + ia++ * width, width);
+            dest += width;
+        }
+        memcpy(dest, ss->buf + ia * width, (len_a - ia) * width);
+    }
+    else
+    {
+        // Merge high: copy B out, fill from the back 
+        memcpy(ss->buf, ss_item(ss, base_b), len_b * width);
+
+        uint8_t *dest = ss_item(ss, base_b + len_b);
+        size_t ia = len_a, ib = len_b;
+        while(ia > 0 && ib > 0)
+        {
+            dest -= width;
+            if(ss_cmp(ss, ss->buf + (ib - 1) * width, ss_item(ss, base_a + ia - 1)) < 0)
+                memcpy(dest, ss_item(ss, base_a + --ia), width);
+            else
+                memcpy(dest, ss->buf + --ib * width, width);
+        }
+        memcpy(ss_item(ss, base_a), ss->buf, ib * width);
+    }
+
+    return 0;
+}
+
+// Restore the run stack invariants after a push 
+static int ss_merge_collapse(StableSort *ss)
+{
+    while(ss->num_runs > 1)
+    {
+        size_t n = ss->num_runs - 2;
+        size_t *len = ss->run_len;
+
+        if((n > 0 && len[n - 1] <= len[n] + len[n + 1]) || (n > 1 && len[n - 2] <= len[n - 1] + len[n]))
+        {
+            if(len[n - 1] < len[n + 1])
+                n--;
+        }
+        else if(len[n] > len[n + 1])
+        {
+            break;
+        }
+
+        if(ss_merge_at(ss, n))
+            return -2;
+    }
+
+    return 0;
+}
+
+static int stable_sort(StableSort *ss, size_t n)
+{
+    ss->buf = NULL;
+    ss->buf_cap = 0;
+    ss->num_runs = 0;
+    ss->temp = malloc(ss->width);
+    if(!ss->temp)
+        return -2;
+
+    int status = 0;
+    size_t min_run = ss_min_run(n);
+    size_t lo = 0;
+
+    while(lo < n && status == 0)
+    {
+        size_t run = ss_count_run(ss, lo, n);
+
+        // Extend short runs to min_run with binary insertion sort 
+        if(run < min_run)
+        {
+            size_t forced = n - lo < min_run ? n - lo : min_run;
+            ss_binary_insertion(ss, lo, lo + run, lo + forced);
+            run = forced;
+        }
+
+        ss->run_base[ss->num_runs] = lo;
+        ss->run_len[ss->num_runs] = run;
+        ss->num_runs++;
+        lo += run;
+
+        status = ss_merge_collapse(ss);
+    }
+
+    while(status == 0 && ss->num_runs > 1)
+    {
+        size_t i = ss->num_runs - 2;
+        if(i > 0 && ss->run_len[i - 1] < ss->run_len[i + 1])
+            i--;
+        status = ss_merge_at(ss, i);
+    }
+
+    free(ss->buf);
+    free(ss->temp);
+
+    return status;
+}
+
+int v_stable_sort(Vector *vec, int(*cmp)(void *a, void *b))
+{
+    if(!vec || !cmp)
+        return -1; // Invalid input 
+
+    StableSort ss = { .arr = vec->vec_array, .width = vec->data_size, .cmp = cmp };
+
+    return stable_sort(&ss, vec->num_elements);
+}
+
+int v_argsort(Vector *vec, int(*cmp)(void *a, void *b), size_t *indices, int apply)
+{
+    if(!vec || !cmp || !indices)
+        return -1; // Invalid input 
+
+    size_t n = vec->num_elements;
+
+    for(size_t i = 0; i < n; i++)
+        indices[i] = i;
+
+    StableSort ss = { .arr = (uint8_t *)indices, .width = sizeof(size_t), 
+                      .records = vec->vec_array, .data_size = vec->data_size, .cmp = cmp };
+
+    if(stable_sort(&ss, n))
+        return -2; // Allocation failed 
+
+    if(!apply || n < 2)
+        return 0;
+
+    // Apply the permutation in place: every record is moved once by following its cycle 
+    uint8_t *visited = calloc((n + 7) / 8, 1);
+    void *temp = malloc(vec->data_size);
+    if(!visited || !temp)
+    {
+        free(visited);
+        free(temp);
+        return -2; // Allocation failed; indices are still valid 
+    }
+
+    uint8_t *arr = vec->vec_array;
+    size_t data_size = vec->data_size;
+
+    for(size_t i = 0; i < n; i++)
+    {
+        if(visited[i / 8] & (1u << (i % 8)))
+            continue;
+
+        if(indices[i] == i)
+        {
+            visited[i / 8] |= 1u << (i % 8);
+            continue;
+        }
+
+        memcpy(temp, arr + i * data_size, data_size);
+
+        size_t j = i;
+        while(1)
+        {
+            visited[j / 8] |= 1u << (j % 8);
+            size_t k = indices[j];
+            if(k == i)
+            {
+                memcpy(arr + j * data_size, temp, data_size);
+                break;
+            }
+            memcpy(arr + j * data_size, arr + k * data_size, data_size);
+            j = k;
+        }
+    }
+
+    free(visited);
+    free(temp);
+
+    return 0;
+}
+
+
+int v_lower_bound(Vector *vec, const void *key, int(*cmp)(void *a, void *b), size_t *index)
+{
+    if(!vec || !key || !cmp || !index)
+        return -1; // Invalid input 
+
+    size_t len = vec->num_elements;
+    size_t data_size = vec->data_size;
+    uint8_t *base = vec->vec_array;
+
+    if(len == 0)
+    {
+        *index = 0;
+        return 0;
+    }
+
+    // Branchless: the range shrinks by half every step and only the base moves 
+    while(len > 1)
+    {
+        size_t half = len / 2;
+        base = cmp(base + half * data_size, (void *)key) < 0 ? base + half * data_size : base;
+        len -= half;
+    }
+
+    *index = (size_t)(base - (uint8_t *)vec->vec_array) / data_size + (cmp(base, (void *)key) < 0);
+
+    return 0;
+}
+
+int v_upper_bound(Vector *vec, const void *key, int(*cmp)(void *a, void *b), size_t *index)
+{
+    if(!vec || !key || !cmp || !index)
+        return -1; // Invalid input 
+
+    size_t len = vec->num_elements;
+    size_t data_size = vec->data_size;
+    uint8_t *base = vec->vec_array;
+
+    if(len == 0)
+    {
+        *index = 0;
+        return 0;
+    }
+
+    while(len > 1)
+    {
+        size_t half = len / 2;
+        base = cmp(base + half * data_size, (void *)key) <= 0 ? base + half * data_size : base;
+        len -= half;
+    }
+
+    *index = (size_t)(base - (uint8_t *)vec->vec_array) / data_size + (cmp(base, (void *)key) <= 0);
+
+    return 0;
+}
+
+int v_equal_range(Vector *vec, const void *key, int(*cmp)(void *a, void *b), size_t *first, size_t *last)
+{
+    if(!first || !last)
+        return -1; // Invalid input 
+
+    if(v_lower_bound(vec, key, cmp, first))
+        return -1;
+
+    return v_upper_bound(vec, key, cmp, last);
+}
+
+// Read-only BFS-order copy of the keys of a sorted vector 
+typedef struct VecEytzinger
+{
+    void    *keys;          // 1-indexed order-preserving keys, uint32_t or uint64_t 
+    size_t  *rank;          // rank[k]: position of node k in the sorted vector 
+    size_t  num_keys;
+    int     wide;           // 1 if keys are uint64_t 
+    VecKeyType key_type;
+} VecEytzinger;
+
+// Fill nodes in-order so that the BFS layout holds the sorted keys 
+static size_t eytzinger_fill(VecEytzinger *ez, const uint8_t *arr, size_t data_size, size_t key_offset, size_t i, size_t k)
+{
+    if(k > ez->num_keys)
+        return i;
+
+    i = eytzinger_fill(ez, arr, data_size, key_offset, i, 2 * k);
+
+    uint64_t key = radix_key(arr + i * data_size + key_offset, ez->key_type);
+    if(ez->wide)
+        ((uint64_t *)ez->keys)[k] = key;
+    else
+        ((uint32_t *)ez->keys)[k] = (uint32_t)key;
+    ez->rank[k] = i;
+
+    return eytzinger_fill(ez, arr, data_size, key_offset, i + 1, 2 * k + 1);
+}
+
+VecEytzinger *v_eytzinger_build(Vector *vec, size_t key_offset, VecKeyType key_type)
+{
+    if(!vec || key_type < V_KEY_U32 || key_type > V_KEY_F64)
+        return NULL; 
+
+    size_t key_width = key_type <= V_KEY_F32 ? 4 : 8;
+
+    if(key_offset > vec->data_size || vec->data_size - key_offset < key_width)
+        return NULL; // Key does not fit inside the element 
+
+    VecEytzinger *ez = malloc(sizeof(VecEytzinger));
+    if(!ez)
+        return NULL;
+
+    size_t n = vec->num_elements;
+
+    // Slot 0 is unused so children of node k sit at 2k and 2k + 1 
+    ez->keys = malloc((n + 1) * key_width);
+    ez->rank = malloc((n + 1) * sizeof(size_t));
+    if(!ez->keys || !ez->rank)
+    {
+        free(ez->keys);
+        free(ez->rank);
+        free(ez);
+        return NULL;
+    }
+
+    ez->num_keys = n;
+    ez->wide = key_width == 8;
+    ez->key_type = key_type;
+
+    eytzinger_fill(ez, vec->vec_array, vec->data_size, key_offset, 0, 1);
+
+    return ez;
+}
+
+void v_eytzinger_destroy(VecEytzinger *ez)
+{
+    if(!ez)
+        return;
+
+    free(ez->keys);
+    free(ez->rank);
+    free(ez);
+}
+
+int v_eytzinger_lower_bound(VecEytzinger *ez, const void *key, size_t *index)
+{
+    if(!ez || !key || !index)
+        return -1; // Invalid input 
+
+    uint64_t x = radix_key(key, ez->key_type);
+    size_t n = ez->num_keys;
+    size_t k = 1;
+
+    // Descend branch-free; the prefetch pulls in the node's descendants as far down as 
+    // one 64-byte line reaches: four levels (16 keys) for 32-bit keys, three levels 
+    // (8 keys) for 64-bit keys. Prefetches past the end never fault 
+    if(ez->wide)
+    {
+        const uint64_t *keys = ez->keys;
+        while(k <= n)
+        {
+            __builtin_prefetch(keys + k * 8);
+            k = 2 * k + (keys[k] < x);
+        }
+    }
+    else
+    {
+        const uint32_t *keys = ez->keys;
+        while(k <= n)
+        {
+            __builtin_prefetch(keys + k * 16);
+            k = 2 * k + (keys[k] < (uint32_t)x);
+        }
+    }
+
+    // Undo the trailing right turns plus the last left turn to reach the answer node 
+    k >>= __builtin_ffsll(~(long long)k);
+
+    *index = k == 0 ? n : ez->rank[k];
+
+    return 0;
+}
+
+
+// Introselect: quickselect with median-of-three pivots, falling back to heap sort 
+// when the recursion budget runs out; temp must hold three elements 
+static void introselect(uint8_t *arr, size_t data_size, size_t n, size_t nth, int(*cmp)(void *a, void *b), uint8_t *temp)
+{
+    size_t lo = 0, hi = n;
+    size_t depth = intro_depth(n);
+
+    while(hi - lo > SORT_INSERTION_THRESHOLD)
+    {
+        if(depth-- == 0)
+        {
+            heap_sort_range(arr + lo * data_size, data_size, hi - lo, cmp, temp);
+            return;
+        }
+
+        size_t j = median3_partition(arr, data_size, lo, hi, cmp, temp);
+
+        if(nth <= j)
+            hi = j + 1;
+        else
+            lo = j + 1;
+    }
+
+    insertion_sort_range(arr + lo * data_size, data_size, hi - lo, cmp, temp);
+}
+
+int v_nth_element(Vector *vec, size_t nth, int(*cmp)(void *a, void *b))
+{
+    if(!vec || !cmp)
+        return -1; // Invalid input 
+
+    if(nth >= vec->num_elements)
+        return -2; // Index is out of bounds 
+
+    uint8_t *temp = malloc(3 * vec->data_size);
+    if(!temp)
+        return -2; // Allocation failed 
+
+    introselect(vec->vec_array, vec->data_size, vec->num_elements, nth, cmp, temp);
+
+    free(temp);
+
+    return 0;
+}
+
+int v_partial_sort(Vector *vec, size_t k, int(*cmp)(void *a, void *b))
+{
+    if(!vec || !cmp)
+        return -1; // Invalid input 
+
+    size_t n = vec->num_elements;
+    if(k > n)
+        k = n;
+    if(k == 0)
+        return 0;
+
+    uint8_t *temp = malloc(3 * vec->data_size);
+    if(!temp)
+        return -2; // Allocation failed 
+
+    // Select the k smallest into the prefix, then sort only the prefix 
+    if(k < n)
+        introselect(vec->vec_array, vec->data_size, n, k, cmp, temp);
+    heap_sort_range(vec->vec_array, vec->data_size, k, cmp, temp);
+
+    free(temp);
+
+    return 0;
+}
+
+int v_top_k(Vector *vec, size_t k, int(*cmp)(void *a, void *b), void *dest)
+{
+    if(!vec || !cmp || (!dest && k > 0))
+        return -1; // Invalid input 
+
+    size_t n = vec->num_elements;
+    size_t data_size = vec->data_size;
+    if(k > n)
+        k = n;
+    if(k == 0)
+        return 0;
+
+    uint8_t *temp = malloc(2 * data_size);
+    if(!temp)
+        return -2; // Allocation failed 
+
+    uint8_t *heap = dest;
+    uint8_t *arr = vec->vec_array;
+
+    // Max-heap of the k best seen so far; its root is the one to evict next 
+    memcpy(heap, arr, k * data_size);
+    for(size_t i = k / 2; i-- > 0; )
+        heap_sift_down(heap, data_size, k, i, cmp, temp);
+
+    for(size_t i = k; i < n; i++)
+    {
+        uint8_t *elem = arr + i * data_size;
+        if(cmp(elem, heap) < 0)
+        {
+            memcpy(heap, elem, data_size);
+            heap_sift_down(heap, data_size, k, 0, cmp, temp);
+        }
+    }
+
+    heap_sort_range(heap, data_size, k, cmp, temp);
+
+    free(temp);
+
+    return 0;
+}
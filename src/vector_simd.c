@@ -0,0 +1,665 @@
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "../include/ds_vector_simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VEC_HAVE_X86_SIMD 1
+#endif
+
+// Elements per block for min/max: a block is rescanned for the index only when it improves the result
+#define MINMAX_BLOCK 1024
+
+// Scalar form of a VecCmpOp, valid for every element type
+#define CMP_SCALAR(a, b, op)                                \
+    ((op) == V_CMP_EQ ? (a) == (b) :                        \
+     (op) == V_CMP_NE ? (a) != (b) :                        \
+     (op) == V_CMP_LT ? (a) <  (b) :                        \
+     (op) == V_CMP_LE ? (a) <= (b) :                        \
+     (op) == V_CMP_GT ? (a) >  (b) : (a) >= (b))
+
+/*
+ * Every instruction set provides, per element type TAG:
+ *   VEC, LANES, LOAD(p), STORE(p, v), SET1(x), MIN(a, b), MAX(a, b)
+ *   EQ(a, b), GT(a, b)         lane comparison returned as a bit per lane
+ *   ACC, ACC_ZERO(), ACC_ADD(acc, v), ACC_STORE(p, acc), ACC_LANES
+ *                              widening sum into 64-bit lanes
+ * and DEFINE_KERNELS instantiates the three kernels from them.
+ */
+
+// ================================ Scalar ================================
+
+#define SCALAR_LANES            1
+#define SCALAR_LOAD(p)          (*(p))
+#define SCALAR_STORE(p, v)      (*(p) = (v))
+#define SCALAR_SET1(x)          (x)
+#define SCALAR_MIN(a, b)        ((b) < (a) ? (b) : (a))
+#define SCALAR_MAX(a, b)        ((b) > (a) ? (b) : (a))
+#define SCALAR_EQ(a, b)         ((unsigned)((a) == (b)))
+#define SCALAR_GT(a, b)         ((unsigned)((a) > (b)))
+#define SCALAR_ACC_ZERO()       0
+#define SCALAR_ACC_STORE(p, a)  (*(p) = (a))
+#define SCALAR_ACC_LANES        1
+
+#define SCALAR_I32_VEC          int32_t
+#define SCALAR_I32_ACC          uint64_t
+#define SCALAR_I32_ACC_ADD(a, v) ((a) + (uint64_t)(int64_t)(v))
+#define SCALAR_I64_VEC          int64_t
+#define SCALAR_I64_ACC          uint64_t
+#define SCALAR_I64_ACC_ADD(a, v) ((a) + (uint64_t)(v))
+#define SCALAR_F32_VEC          float
+#define SCALAR_F32_ACC          double
+#define SCALAR_F32_ACC_ADD(a, v) ((a) + (double)(v))
+#define SCALAR_F64_VEC          double
+#define SCALAR_F64_ACC          double
+#define SCALAR_F64_ACC_ADD(a, v) ((a) + (v))
+
+#ifdef VEC_HAVE_X86_SIMD
+
+// =============================== SSE4.2 =================================
+
+#define SSE42_I32_VEC           __m128i
+#define SSE42_I32_LANES         4
+#define SSE42_I32_LOAD(p)       _mm_loadu_si128((const __m128i *)(p))
+#define SSE42_I32_STORE(p, v)   _mm_storeu_si128((__m128i *)(p), (v))
+#define SSE42_I32_SET1(x)       _mm_set1_epi32(x)
+#define SSE42_I32_MIN(a, b)     _mm_min_epi32((a), (b))
+#define SSE42_I32_MAX(a, b)     _mm_max_epi32((a), (b))
+#define SSE42_I32_EQ(a, b)      (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32((a), (b))))
+#define SSE42_I32_GT(a, b)      (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32((a), (b))))
+#define SSE42_I32_ACC           __m128i
+#define SSE42_I32_ACC_ZERO()    _mm_setzero_si128()
+#define SSE42_I32_ACC_ADD(a, v) _mm_add_epi64(_mm_add_epi64((a), _mm_cvtepi32_epi64(v)), \
+                                              _mm_cvtepi32_epi64(_mm_srli_si128((v), 8)))
+#define SSE42_I32_ACC_STORE(p, a) _mm_storeu_si128((__m128i *)(p), (a))
+#define SSE42_I32_ACC_LANES     2
+
+#define SSE42_I64_VEC           __m128i
+#define SSE42_I64_LANES         2
+#define SSE42_I64_LOAD(p)       _mm_loadu_si128((const __m128i *)(p))
+#define SSE42_I64_STORE(p, v)   _mm_storeu_si128((__m128i *)(p), (v))
+#define SSE42_I64_SET1(x)       _mm_set1_epi64x(x)
+#define SSE42_I64_MIN(a, b)     _mm_blendv_epi8((a), (b), _mm_cmpgt_epi64((a), (b)))
+#define SSE42_I64_MAX(a, b)     _mm_blendv_epi8((b), (a), _mm_cmpgt_epi64((a), (b)))
+#define SSE42_I64_EQ(a, b)      (unsigned)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64((a), (b))))
+#define SSE42_I64_GT(a, b)      (unsigned)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64((a), (b))))
+#define SSE42_I64_ACC           __m128i
+#define SSE42_I64_ACC_ZERO()    _mm_setzero_si128()
+#define SSE42_I64_ACC_ADD(a, v) _mm_add_epi64((a), (v))
+#define SSE42_I64_ACC_STORE(p, a) _mm_storeu_si128((__m128i *)(p), (a))
+#define SSE42_I64_ACC_LANES     2
+
+#define SSE42_F32_VEC           __m128
+#define SSE42_F32_LANES         4
+#define SSE42_F32_LOAD(p)       _mm_loadu_ps(p)
+#define SSE42_F32_STORE(p, v)   _mm_storeu_ps((p), (v))
+#define SSE42_F32_SET1(x)       _mm_set1_ps(x)
+#define SSE42_F32_MIN(a, b)     _mm_min_ps((a), (b))
+#define SSE42_F32_MAX(a, b)     _mm_max_ps((a), (b))
+#define SSE42_F32_EQ(a, b)      (unsigned)_mm_movemask_ps(_mm_cmpeq_ps((a), (b)))
+#define SSE42_F32_GT(a, b)      (unsigned)_mm_movemask_ps(_mm_cmpgt_ps((a), (b)))
+#define SSE42_F32_ACC           __m128d
+#define SSE42_F32_ACC_ZERO()    _mm_setzero_pd()
+#define SSE42_F32_ACC_ADD(a, v) _mm_add_pd(_mm_add_pd((a), _mm_cvtps_pd(v)), _mm_cvtps_pd(_mm_movehl_ps((v), (v))))
+#define SSE42_F32_ACC_STORE(p, a) _mm_storeu_pd((p), (a))
+#define SSE42_F32_ACC_LANES     2
+
+#define SSE42_F64_VEC           __m128d
+#define SSE42_F64_LANES         2
+#define SSE42_F64_LOAD(p)       _mm_loadu_pd(p)
+#define SSE42_F64_STORE(p, v)   _mm_storeu_pd((p), (v))
+#define SSE42_F64_SET1(x)       _mm_set1_pd(x)
+#define SSE42_F64_MIN(a, b)     _mm_min_pd((a), (b))
+#define SSE42_F64_MAX(a, b)     _mm_max_pd((a), (b))
+#define SSE42_F64_EQ(a, b)      (unsigned)_mm_movemask_pd(_mm_cmpeq_pd((a), (b)))
+#define SSE42_F64_GT(a, b)      (unsigned)_mm_movemask_pd(_mm_cmpgt_pd((a), (b)))
+#define SSE42_F64_ACC           __m128d
+#define SSE42_F64_ACC_ZERO()    _mm_setzero_pd()
+#define SSE42_F64_ACC_ADD(a, v) _mm_add_pd((a), (v))
+#define SSE42_F64_ACC_STORE(p, a) _mm_storeu_pd((p), (a))
+#define SSE42_F64_ACC_LANES     2
+
+// ================================ AVX2 ==================================
+
+#define AVX2_I32_VEC            __m256i
+#define AVX2_I32_LANES          8
+#define AVX2_I32_LOAD(p)        _mm256_loadu_si256((const __m256i *)(p))
+#define AVX2_I32_STORE(p, v)    _mm256_storeu_si256((__m256i *)(p), (v))
+#define AVX2_I32_SET1(x)        _mm256_set1_epi32(x)
+#define AVX2_I32_MIN(a, b)      _mm256_min_epi32((a), (b))
+#define AVX2_I32_MAX(a, b)      _mm256_max_epi32((a), (b))
+#define AVX2_I32_EQ(a, b)       (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32((a), (b))))
+#define AVX2_I32_GT(a, b)       (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32((a), (b))))
+#define AVX2_I32_ACC            __m256i
+#define AVX2_I32_ACC_ZERO()     _mm256_setzero_si256()
+#define AVX2_I32_ACC_ADD(a, v)  _mm256_add_epi64(_mm256_add_epi64((a), _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v))), \
+                                                 _mm256_cvtepi32_epi64(_mm256_extracti128_si256((v), 1)))
+#define AVX2_I32_ACC_STORE(p, a) _mm256_storeu_si256((__m256i *)(p), (a))
+#define AVX2_I32_ACC_LANES      4
+
+#define AVX2_I64_VEC            __m256i
+#define AVX2_I64_LANES          4
+#define AVX2_I64_LOAD(p)        _mm256_loadu_si256((const __m256i *)(p))
+#define AVX2_I64_STORE(p, v)    _mm256_storeu_si256((__m256i *)(p), (v))
+#define AVX2_I64_SET1(x)        _mm256_set1_epi64x(x)
+#define AVX2_I64_MIN(a, b)      _mm256_blendv_epi8((a), (b), _mm256_cmpgt_epi64((a), (b)))
+#define AVX2_I64_MAX(a, b)      _mm256_blendv_epi8((b), (a), _mm256_cmpgt_epi64((a), (b)))
+#define AVX2_I64_EQ(a, b)       (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64((a), (b))))
+#define AVX2_I64_GT(a, b)       (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64((a), (b))))
+#define AVX2_I64_ACC            __m256i
+#define AVX2_I64_ACC_ZERO()     _mm256_setzero_si256()
+#define AVX2_I64_ACC_ADD(a, v)  _mm256_add_epi64((a), (v))
+#define AVX2_I64_ACC_STORE(p, a) _mm256_storeu_si256((__m256i *)(p), (a))
+#define AVX2_I64_ACC_LANES      4
+
+#define AVX2_F32_VEC            __m256
+#define AVX2_F32_LANES          8
+#define AVX2_F32_LOAD(p)        _mm256_loadu_ps(p)
+#define AVX2_F32_STORE(p, v)    _mm256_storeu_ps((p), (v))
+#define AVX2_F32_SET1(x)        _mm256_set1_ps(x)
+#define AVX2_F32_MIN(a, b)      _mm256_min_ps((a), (b))
+#define AVX2_F32_MAX(a, b)      _mm256_max_ps((a), (b))
+#define AVX2_F32_EQ(a, b)       (unsigned)_mm256_movemask_ps(_mm256_cmp_ps((a), (b), _CMP_EQ_OQ))
+#define AVX2_F32_GT(a, b)       (unsigned)_mm256_movemask_ps(_mm256_cmp_ps((a), (b), _CMP_GT_OQ))
+#define AVX2_F32_ACC            __m256d
+#define AVX2_F32_ACC_ZERO()     _mm256_setzero_pd()
+#define AVX2_F32_ACC_ADD(a, v)  _mm256_add_pd(_mm256_add_pd((a), _mm256_cvtps_pd(_mm256_castps256_ps128(v))), \
+                                              _mm256_cvtps_pd(_mm256_extractf128_ps((v), 1)))
+#define AVX2_F32_ACC_STORE(p, a) _mm256_storeu_pd((p), (a))
+#define AVX2_F32_ACC_LANES      4
+
+#define AVX2_F64_VEC            __m256d
+#define AVX2_F64_LANES          4
+#define AVX2_F64_LOAD(p)        _mm256_loadu_pd(p)
+#define AVX2_F64_STORE(p, v)    _mm256_storeu_pd((p), (v))
+#define AVX2_F64_SET1(x)        _mm256_set1_pd(x)
+#define AVX2_F64_MIN(a, b)      _mm256_min_pd((a), (b))
+#define AVX2_F64_MAX(a, b)      _mm256_max_pd((a), (b))
+#define AVX2_F64_EQ(a, b)       (unsigned)_mm256_movemask_pd(_mm256_cmp_pd((a), (b), _CMP_EQ_OQ))
+#define AVX2_F64_GT(a, b)       (unsigned)_mm256_movemask_pd(_mm256_cmp_pd((a), (b), _CMP_GT_OQ))
+#define AVX2_F64_ACC            __m256d
+#define AVX2_F64_ACC_ZERO()     _mm256_setzero_pd()
+#define AVX2_F64_ACC_ADD(a, v)  _mm256_add_pd((a), (v))
+#define AVX2_F64_ACC_STORE(p, a) _mm256_storeu_pd((p), (a))
+#define AVX2_F64_ACC_LANES      4
+
+// =============================== AVX-512 ================================
+
+#define AVX512_I32_VEC          __m512i
+#define AVX512_I32_LANES        16
+#define AVX512_I32_LOAD(p)      _mm512_loadu_si512((const void *)(p))
+#define AVX512_I32_STORE(p, v)  _mm512_storeu_si512((void *)(p), (v))
+#define AVX512_I32_SET1(x)      _mm512_set1_epi32(x)
+#define AVX512_I32_MIN(a, b)    _mm512_min_epi32((a), (b))
+#define AVX512_I32_MAX(a, b)    _mm512_max_epi32((a), (b))
+#define AVX512_I32_EQ(a, b)     (unsigned)_mm512_cmpeq_epi32_mask((a), (b))
+#define AVX512_I32_GT(a, b)     (unsigned)_mm512_cmpgt_epi32_mask((a), (b))
+#define AVX512_I32_ACC          __m512i
+#define AVX512_I32_ACC_ZERO()   _mm512_setzero_si512()
+#define AVX512_I32_ACC_ADD(a, v) _mm512_add_epi64(_mm512_add_epi64((a), _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v))), \
+                                                  _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64((v), 1)))
+#define AVX512_I32_ACC_STORE(p, a) _mm512_storeu_si512((void *)(p), (a))
+#define AVX512_I32_ACC_LANES    8
+
+#define AVX512_I64_VEC          __m512i
+#define AVX512_I64_LANES        8
+#define AVX512_I64_LOAD(p)      _mm512_loadu_si512((const void *)(p))
+#define AVX512_I64_STORE(p, v)  _mm512_storeu_si512((void *)(p), (v))
+#define AVX512_I64_SET1(x)      _mm512_set1_epi64(x)
+#define AVX512_I64_MIN(a, b)    _mm512_min_epi64((a), (b))
+#define AVX512_I64_MAX(a, b)    _mm512_max_epi64((a), (b))
+#define AVX512_I64_EQ(a, b)     (unsigned)_mm512_cmpeq_epi64_mask((a), (b))
+#define AVX512_I64_GT(a, b)     (unsigned)_mm512_cmpgt_epi64_mask((a), (b))
+#define AVX512_I64_ACC          __m512i
+#define AVX512_I64_ACC_ZERO()   _mm512_setzero_si512()
+#define AVX512_I64_ACC_ADD(a, v) _mm512_add_epi64((a), (v))
+#define AVX512_I64_ACC_STORE(p, a) _mm512_storeu_si512((void *)(p), (a))
+#define AVX512_I64_ACC_LANES    8
+
+#define AVX512_F32_VEC          __m512
+#define AVX512_F32_LANES        16
+#define AVX512_F32_LOAD(p)      _mm512_loadu_ps(p)
+#define AVX512_F32_STORE(p, v)  _mm512_storeu_ps((p), (v))
+#define AVX512_F32_SET1(x)      _mm512_set1_ps(x)
+#define AVX512_F32_MIN(a, b)    _mm512_min_ps((a), (b))
+#define AVX512_F32_MAX(a, b)    _mm512_max_ps((a), (b))
+#define AVX512_F32_EQ(a, b)     (unsigned)_mm512_cmp_ps_mask((a), (b), _CMP_EQ_OQ)
+#define AVX512_F32_GT(a, b)     (unsigned)_mm512_cmp_ps_mask((a), (b), _CMP_GT_OQ)
+#define AVX512_F32_ACC          __m512d
+#define AVX512_F32_ACC_ZERO()   _mm512_setzero_pd()
+#define AVX512_F32_ACC_ADD(a, v) _mm512_add_pd(_mm512_add_pd((a), _mm512_cvtps_pd(_mm512_castps512_ps256(v))), \
+                                 _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1))))
+#define AVX512_F32_ACC_STORE(p, a) _mm512_storeu_pd((p), (a))
+#define AVX512_F32_ACC_LANES    8
+
+#define AVX512_F64_VEC          __m512d
+#define AVX512_F64_LANES        8
+#define AVX512_F64_LOAD(p)      _mm512_loadu_pd(p)
+#define AVX512_F64_STORE(p, v)  _mm512_storeu_pd((p), (v))
+#define AVX512_F64_SET1(x)      _mm512_set1_pd(x)
+#define AVX512_F64_MIN(a, b)    _mm512_min_pd((a), (b))
+#define AVX512_F64_MAX(a, b)    _mm512_max_pd((a), (b))
+#define AVX512_F64_EQ(a, b)     (unsigned)_mm512_cmp_pd_mask((a), (b), _CMP_EQ_OQ)
+#define AVX512_F64_GT(a, b)     (unsigned)_mm512_cmp_pd_mask((a), (b), _CMP_GT_OQ)
+#define AVX512_F64_ACC          __m512d
+#define AVX512_F64_ACC_ZERO()   _mm512_setzero_pd()
+#define AVX512_F64_ACC_ADD(a, v) _mm512_add_pd((a), (v))
+#define AVX512_F64_ACC_STORE(p, a) _mm512_storeu_pd((p), (a))
+#define AVX512_F64_ACC_LANES    8
+
+#endif // VEC_HAVE_X86_SIMD
+
+// Scalar ops are shared by every element type
+#define SCALAR_I32_LANES        SCALAR_LANES
+#define SCALAR_I64_LANES        SCALAR_LANES
+#define SCALAR_F32_LANES        SCALAR_LANES
+#define SCALAR_F64_LANES        SCALAR_LANES
+#define SCALAR_I32_LOAD         SCALAR_LOAD
+#define SCALAR_I64_LOAD         SCALAR_LOAD
+#define SCALAR_F32_LOAD         SCALAR_LOAD
+#define SCALAR_F64_LOAD         SCALAR_LOAD
+#define SCALAR_I32_STORE        SCALAR_STORE
+#define SCALAR_I64_STORE        SCALAR_STORE
+#define SCALAR_F32_STORE        SCALAR_STORE
+#define SCALAR_F64_STORE        SCALAR_STORE
+#define SCALAR_I32_SET1         SCALAR_SET1
+#define SCALAR_I64_SET1         SCALAR_SET1
+#define SCALAR_F32_SET1         SCALAR_SET1
+#define SCALAR_F64_SET1         SCALAR_SET1
+#define SCALAR_I32_MIN          SCALAR_MIN
+#define SCALAR_I64_MIN          SCALAR_MIN
+#define SCALAR_F32_MIN          SCALAR_MIN
+#define SCALAR_F64_MIN          SCALAR_MIN
+#define SCALAR_I32_MAX          SCALAR_MAX
+#define SCALAR_I64_MAX          SCALAR_MAX
+#define SCALAR_F32_MAX          SCALAR_MAX
+#define SCALAR_F64_MAX          SCALAR_MAX
+#define SCALAR_I32_EQ           SCALAR_EQ
+#define SCALAR_I64_EQ           SCALAR_EQ
+#define SCALAR_F32_EQ           SCALAR_EQ
+#define SCALAR_F64_EQ           SCALAR_EQ
+#define SCALAR_I32_GT           SCALAR_GT
+#define SCALAR_I64_GT           SCALAR_GT
+#define SCALAR_F32_GT           SCALAR_GT
+#define SCALAR_F64_GT           SCALAR_GT
+#define SCALAR_I32_ACC_ZERO     SCALAR_ACC_ZERO
+#define SCALAR_I64_ACC_ZERO     SCALAR_ACC_ZERO
+#define SCALAR_F32_ACC_ZERO     SCALAR_ACC_ZERO
+#define SCALAR_F64_ACC_ZERO     SCALAR_ACC_ZERO
+#define SCALAR_I32_ACC_STORE    SCALAR_ACC_STORE
+#define SCALAR_I64_ACC_STORE    SCALAR_ACC_STORE
+#define SCALAR_F32_ACC_STORE    SCALAR_ACC_STORE
+#define SCALAR_F64_ACC_STORE    SCALAR_ACC_STORE
+#define SCALAR_I32_ACC_LANES    SCALAR_ACC_LANES
+#define SCALAR_I64_ACC_LANES    SCALAR_ACC_LANES
+#define SCALAR_F32_ACC_LANES    SCALAR_ACC_LANES
+#define SCALAR_F64_ACC_LANES    SCALAR_ACC_LANES
+
+/*
+ * Kernels for one (instruction set, element type) pair:
+ *   mask    bit i set if data[i] op value, for n <= 64 elements
+ *   minmax  smallest and largest of n >= 1 elements
+ *   sum     adds n elements to *acc (uint64_t for integers, double for floats)
+ */
+#define DEFINE_KERNELS(ISA, TAG, T, ACC_T, ATTR)                                            \
+ATTR static uint64_t ISA##_##TAG##_mask(const void *data, size_t n, const void *value, VecCmpOp op) \
+{                                                                                           \
+    const T *p = data;                                                                      \
+    T x;                                                                                    \
+    memcpy(&x, value, sizeof(T));                                                           \
+                                                                                            \
+    const unsigned all = (1u << ISA##_##TAG##_LANES) - 1;                                   \
+    ISA##_##TAG##_VEC vx = ISA##_##TAG##_SET1(x);                                           \
+    uint64_t bits = 0;                                                                      \
+    size_t i = 0;                                                                           \
+                                                                                            \
+    for(; i + ISA##_##TAG##_LANES <= n; i += ISA##_##TAG##_LANES)                           \
+    {                                                                                       \
+        ISA##_##TAG##_VEC v = ISA##_##TAG##_LOAD(p + i);                                    \
+        unsigned m;                                                                         \
+        switch(op)                                                                          \
+        {                                                                                   \
+            case V_CMP_EQ: m = ISA##_##TAG##_EQ(v, vx); break;                              \
+            case V_CMP_NE: m = ISA##_##TAG##_EQ(v, vx) ^ all; break;                        \
+            case V_CMP_LT: m = ISA##_##TAG##_GT(vx, v); break;                              \
+            case V_CMP_LE: m = ISA##_##TAG##_GT(vx, v) | ISA##_##TAG##_EQ(v, vx); break;    \
+            case V_CMP_GT: m = ISA##_##TAG##_GT(v, vx); break;                              \
+            default:       m = ISA##_##TAG##_GT(v, vx) | ISA##_##TAG##_EQ(v, vx); break;    \
+        }                                                                                   \
+        bits |= (uint64_t)m << i;                                                           \
+    }                                                                                       \
+                                                                                            \
+    for(; i < n; i++)                                                                       \
+        bits |= (uint64_t)CMP_SCALAR(p[i], x, op) << i;                                     \
+                                                                                            \
+    return bits;                                                                            \
+}                                                                                           \
+                                                                                            \
+ATTR static void ISA##_##TAG##_minmax(const void *data, size_t n, void *min_out, void *max_out) \
+{                                                                                           \
+    const T *p = data;                                                                      \
+    T mn = p[0], mx = p[0];                                                                 \
+    size_t i = 0;                                                                           \
+                                                                                            \
+    if(n >= ISA##_##TAG##_LANES)                                                            \
+    {                                                                                       \
+        ISA##_##TAG##_VEC vmin = ISA##_##TAG##_LOAD(p);                                     \
+        ISA##_##TAG##_VEC vmax = vmin;                                                      \
+                                                                                            \
+        for(i = ISA##_##TAG##_LANES; i + ISA##_##TAG##_LANES <= n; i += ISA##_##TAG##_LANES)\
+        {                                                                                   \
+            ISA##_##TAG##_VEC v = ISA##_##TAG##_LOAD(p + i);                                \
+            vmin = ISA##_##TAG##_MIN(vmin, v);                                              \
+            vmax = ISA##_##TAG##_MAX(vmax, v);                                              \
+        }                                                                                   \
+                                                                                            \
+        T lanes[ISA##_##TAG##_LANES];                                                       \
+        ISA##_##TAG##_STORE(lanes, vmin);                                                   \
+        for(size_t k = 0; k < ISA##_##TAG##_LANES; k++)                                     \
+            mn = lanes[k] < mn ? lanes[k] : mn;                                             \
+        ISA##_##TAG##_STORE(lanes, vmax);                                                   \
+        for(size_t k = 0; k < ISA##_##TAG##_LANES; k++)                                     \
+            mx = lanes[k] > mx ? lanes[k] : mx;                                             \
+    }                                                                                       \
+                                                                                            \
+    for(; i < n; i++)                                                                       \
+    {                                                                                       \
+        mn = p[i] < mn ? p[i] : mn;                                                         \
+        mx = p[i] > mx ? p[i] : mx;                                                         \
+    }                                                                                       \
+                                                                                            \
+    memcpy(min_out, &mn, sizeof(T));                                                        \
+    memcpy(max_out, &mx, sizeof(T));                                                        \
+}                                                                                           \
+                                                                                            \
+ATTR static void ISA##_##TAG##_sum(const void *data, size_t n, void *acc_inout)             \
+{                                                                                           \
+    const T *p = data;                                                                      \
+    ACC_T total;                                                                            \
+    memcpy(&total, acc_inout, sizeof(ACC_T));                                               \
+                                                                                            \
+    ISA##_##TAG##_ACC acc = ISA##_##TAG##_ACC_ZERO();                                       \
+    size_t i = 0;                                                                           \
+    for(; i + ISA##_##TAG##_LANES <= n; i += ISA##_##TAG##_LANES)                           \
+        acc = ISA##_##TAG##_ACC_ADD(acc, ISA##_##TAG##_LOAD(p + i));                        \
+                                                                                            \
+    ACC_T lanes[ISA##_##TAG##_ACC_LANES];                                                   \
+    ISA##_##TAG##_ACC_STORE(lanes, acc);                                                    \
+    for(size_t k = 0; k < ISA##_##TAG##_ACC_LANES; k++)                                     \
+        total += lanes[k];                                                                  \
+                                                                                            \
+    for(; i < n; i++)                                                                       \
+        total += (ACC_T)p[i];                                                               \
+                                                                                            \
+    memcpy(acc_inout, &total, sizeof(ACC_T));                                               \
+}
+
+#define DEFINE_ALL_TYPES(ISA, ATTR)                                                         \
+    DEFINE_KERNELS(ISA, I32, int32_t, uint64_t, ATTR)                                       \
+    DEFINE_KERNELS(ISA, I64, int64_t, uint64_t, ATTR)                                       \
+    DEFINE_KERNELS(ISA, F32, float,   double,   ATTR)                                       \
+    DEFINE_KERNELS(ISA, F64, double,  double,   ATTR)
+
+DEFINE_ALL_TYPES(SCALAR, )
+
+#ifdef VEC_HAVE_X86_SIMD
+DEFINE_ALL_TYPES(SSE42, __attribute__((target("sse4.2"))))
+DEFINE_ALL_TYPES(AVX2, __attribute__((target("avx2"))))
+DEFINE_ALL_TYPES(AVX512, __attribute__((target("avx512f"))))
+#endif
+
+// ============================ Runtime Dispatch ==========================
+
+typedef struct
+{
+    uint64_t (*mask)(const void *data, size_t n, const void *value, VecCmpOp op);
+    void     (*minmax)(const void *data, size_t n, void *min_out, void *max_out);
+    void     (*sum)(const void *data, size_t n, void *acc_inout);
+} SimdKernels;
+
+#define KERNEL_ROW(ISA) {                                                                   \
+    { ISA##_I32_mask, ISA##_I32_minmax, ISA##_I32_sum },                                    \
+    { ISA##_I64_mask, ISA##_I64_minmax, ISA##_I64_sum },                                    \
+    { ISA##_F32_mask, ISA##_F32_minmax, ISA##_F32_sum },                                    \
+    { ISA##_F64_mask, ISA##_F64_minmax, ISA##_F64_sum } }
+
+// Indexed by [VecSimdLevel][element type]
+static const SimdKernels kernel_table[][4] = {
+    KERNEL_ROW(SCALAR),
+#ifdef VEC_HAVE_X86_SIMD
+    KERNEL_ROW(SSE42),
+    KERNEL_ROW(AVX2),
+    KERNEL_ROW(AVX512),
+#endif
+};
+
+// Read by kernels on any thread; -1 until the first v_simd_level() detects the CPU
+static _Atomic int active_level = -1;
+
+static VecSimdLevel detect_level(void)
+{
+#ifdef VEC_HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f"))
+        return V_SIMD_AVX512;
+    if(__builtin_cpu_supports("avx2"))
+        return V_SIMD_AVX2;
+    if(__builtin_cpu_supports("sse4.2"))
+        return V_SIMD_SSE42;
+#endif
+    return V_SIMD_SCALAR;
+}
+
+VecSimdLevel v_simd_level(void)
+{
+    int level = atomic_load_explicit(&active_level, memory_order_relaxed);
+    if(level >= 0)
+        return (VecSimdLevel)level;
+
+    // Racing first callers detect the same level; only the first one stores it
+    int expected = -1;
+    level = detect_level();
+    if(!atomic_compare_exchange_strong(&active_level, &expected, level))
+        level = expected;
+
+    return (VecSimdLevel)level;
+}
+
+VecSimdLevel v_simd_set_level(VecSimdLevel max_level)
+{
+    int best = detect_level();
+    int level = (int)max_level < best ? (int)max_level : best;
+    if(level < V_SIMD_SCALAR)
+        level = V_SIMD_SCALAR;
+
+    atomic_store(&active_level, level);
+
+    return (VecSimdLevel)level;
+}
+
+// Map the element type onto a kernel_table column; -1 if unsupported or mismatched
+static int kernel_column(Vector *vec, VecKeyType type)
+{
+    switch(type)
+    {
+        case V_KEY_I32: return v_data_size(vec) == sizeof(int32_t) ? 0 : -1;
+        case V_KEY_I64: return v_data_size(vec) == sizeof(int64_t) ? 1 : -1;
+        case V_KEY_F32: return v_data_size(vec) == sizeof(float)   ? 2 : -1;
+        case V_KEY_F64: return v_data_size(vec) == sizeof(double)  ? 3 : -1;
+        default:        return -1;
+    }
+}
+
+static const SimdKernels *get_kernels(Vector *vec, VecKeyType type)
+{
+    if(!vec)
+        return NULL;
+
+    int column = kernel_column(vec, type);
+    if(column < 0)
+        return NULL;
+
+    return &kernel_table[v_simd_level()][column];
+}
+
+// ============================== Public API ==============================
+
+int v_find_value(Vector *vec, VecKeyType type, const void *value, size_t *index)
+{
+    const SimdKernels *k = get_kernels(vec, type);
+    if(!k || !value || !index)
+        return -1; // Invalid input
+
+    size_t n;
+    const uint8_t *data = v_data(vec, &n);
+    size_t width = v_data_size(vec);
+
+    for(size_t i = 0; i < n; i += 64)
+    {
+        size_t block = n - i < 64 ? n - i : 64;
+        uint64_t bits = k->mask(data + i * width, block, value, V_CMP_EQ);
+        if(bits)
+        {
+            *index = i + (size_t)__builtin_ctzll(bits);
+            return 0;
+        }
+    }
+
+    return 1; // Not found
+}
+
+int v_count_value(Vector *vec, VecKeyType type, const void *value, size_t *count)
+{
+    const SimdKernels *k = get_kernels(vec, type);
+    if(!k || !value || !count)
+        return -1; // Invalid input
+
+    size_t n;
+    const uint8_t *data = v_data(vec, &n);
+    size_t width = v_data_size(vec);
+    size_t total = 0;
+
+    for(size_t i = 0; i < n; i += 64)
+    {
+        size_t block = n - i < 64 ? n - i : 64;
+        total += (size_t)__builtin_popcountll(k->mask(data + i * width, block, value, V_CMP_EQ));
+    }
+
+    *count = total;
+
+    return 0;
+}
+
+int v_compare_mask(Vector *vec, VecKeyType type, VecCmpOp op, const void *value, uint64_t *mask)
+{
+    const SimdKernels *k = get_kernels(vec, type);
+    if(!k || !value || !mask || op < V_CMP_EQ || op > V_CMP_GE)
+        return -1; // Invalid input
+
+    size_t n;
+    const uint8_t *data = v_data(vec, &n);
+    size_t width = v_data_size(vec);
+
+    for(size_t i = 0; i < n; i += 64)
+    {
+        size_t block = n - i < 64 ? n - i : 64;
+        mask[i / 64] = k->mask(data + i * width, block, value, op);
+    }
+
+    return 0;
+}
+
+// First index in [begin, begin + len) holding exactly the given element
+static size_t first_equal(const SimdKernels *k, const uint8_t *data, size_t width, size_t begin, size_t len, const void *value)
+{
+    for(size_t i = begin; i < begin + len; i += 64)
+    {
+        size_t block = begin + len - i < 64 ? begin + len - i : 64;
+        uint64_t bits = k->mask(data + i * width, block, value, V_CMP_EQ);
+        if(bits)
+            return i + (size_t)__builtin_ctzll(bits);
+    }
+
+    return begin;
+}
+
+// Typed "a < b" for the kernel column, on raw element bytes
+static int less_than(int column, const void *a, const void *b)
+{
+    switch(column)
+    {
+        case 0: { int32_t x, y; memcpy(&x, a, 4); memcpy(&y, b, 4); return x < y; }
+        case 1: { int64_t x, y; memcpy(&x, a, 8); memcpy(&y, b, 8); return x < y; }
+        case 2: { float x, y;   memcpy(&x, a, 4); memcpy(&y, b, 4); return x < y; }
+        default: { double x, y; memcpy(&x, a, 8); memcpy(&y, b, 8); return x < y; }
+    }
+}
+
+int v_min_max(Vector *vec, VecKeyType type, size_t *min_index, size_t *max_index)
+{
+    const SimdKernels *k = get_kernels(vec, type);
+    if(!k || (!min_index && !max_index))
+        return -1; // Invalid input
+
+    size_t n;
+    const uint8_t *data = v_data(vec, &n);
+    if(n == 0)
+        return 1; // Empty vector
+
+    int column = kernel_column(vec, type);
+    size_t width = v_data_size(vec);
+    uint8_t best_min[8], best_max[8], block_min[8], block_max[8];
+    size_t imin = 0, imax = 0;
+
+    for(size_t i = 0; i < n; i += MINMAX_BLOCK)
+    {
+        size_t block = n - i < MINMAX_BLOCK ? n - i : MINMAX_BLOCK;
+        k->minmax(data + i * width, block, block_min, block_max);
+
+        // Strict comparisons keep the first occurrence across blocks
+        if(i == 0 || less_than(column, block_min, best_min))
+        {
+            memcpy(best_min, block_min, width);
+            imin = first_equal(k, data, width, i, block, block_min);
+        }
+        if(i == 0 || less_than(column, best_max, block_max))
+        {
+            memcpy(best_max, block_max, width);
+            imax = first_equal(k, data, width, i, block, block_max);
+        }
+    }
+
+    if(min_index)
+        *min_index = imin;
+    if(max_index)
+        *max_index = imax;
+
+    return 0;
+}
+
+int v_sum(Vector *vec, VecKeyType type, void *result)
+{
+    const SimdKernels *k = get_kernels(vec, type);
+    if(!k || !result)
+        return -1; // Invalid input
+
+    size_t n;
+    const uint8_t *data = v_data(vec, &n);
+
+    // 8-byte accumulator: int64_t bits for integer types, double for floating point
+    uint64_t acc = 0;
+    if(type == V_KEY_F32 || type == V_KEY_F64)
+    {
+        double zero = 0.0;
+        memcpy(&acc, &zero, sizeof(acc));
+    }
+
+    k->sum(data, n, &acc);
+
+    memcpy(result, &acc, sizeof(acc));
+
+    return 0;
+}
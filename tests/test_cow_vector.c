@@ -0,0 +1,316 @@
+// test_cow_vector.c
+// Tests for the copy-on-write vector (ds_cow_vector.h): writer operations,
+// snapshot isolation, chunk sharing between versions, and readers taking
+// snapshots on other threads while the writer publishes updates.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../include/ds_cow_vector.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+// 1. Writer operations and invalid input
+static void test_writer_ops(void) {
+    CowVector *cv = cv_create(sizeof(int), 5); // rounded up to 8 per chunk
+    int x = 0;
+
+    EXPECT_TRUE(cv_create(0, 8) == NULL, "cv_create with zero data_size");
+    EXPECT_EQ_INT(cv_push_back(NULL, &x), -1, "push_back on NULL");
+    EXPECT_EQ_INT(cv_pop_back(cv), 1, "pop_back on empty");
+    EXPECT_EQ_INT(cv_get(cv, &x, 0), -2, "get out of bounds");
+    EXPECT_EQ_INT(cv_set(cv, &x, 0), -2, "set out of bounds");
+    EXPECT_TRUE(cv_at(cv, 0) == NULL, "cv_at out of bounds");
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_EQ_INT(cv_push_back(cv, &i), 0, "push_back");
+    EXPECT_EQ_SIZE(cv_size(cv), 100, "size after pushes");
+
+    int ok = 1;
+    for (int i = 0; i < 100; i++) {
+        cv_get(cv, &x, i);
+        ok &= x == i;
+    }
+    EXPECT_TRUE(ok, "get after pushes");
+
+    x = -5;
+    EXPECT_EQ_INT(cv_set(cv, &x, 42), 0, "set");
+    *(int *)cv_at(cv, 43) = -6;
+    cv_get(cv, &x, 42);
+    EXPECT_EQ_INT(x, -5, "get after set");
+    cv_get(cv, &x, 43);
+    EXPECT_EQ_INT(x, -6, "get after write through cv_at");
+
+    for (int i = 0; i < 37; i++)
+        cv_pop_back(cv);
+    EXPECT_EQ_SIZE(cv_size(cv), 63, "size after pops");
+
+    int more[20];
+    for (int i = 0; i < 20; i++)
+        more[i] = 1000 + i;
+    EXPECT_EQ_INT(cv_append_n(cv, more, 20), 0, "append_n");
+    cv_get(cv, &x, 62);
+    EXPECT_EQ_INT(x, 62, "element before append_n");
+    cv_get(cv, &x, 82);
+    EXPECT_EQ_INT(x, 1019, "last appended element");
+
+    // Oversized counts fail before any table or chunk is written
+    EXPECT_EQ_INT(cv_append_n(cv, more, SIZE_MAX - 85), -2, "append_n whose chunk count wraps");
+    EXPECT_EQ_INT(cv_append_n(cv, more, SIZE_MAX / 2), -2, "append_n with an unallocatable table");
+    EXPECT_EQ_SIZE(cv_size(cv), 83, "failed append_n leaves the size");
+
+    cv_destroy(cv);
+}
+
+// 2. Snapshots are immutable and share untouched chunks
+static void test_snapshot_isolation(void) {
+    const size_t n = 1000;
+    Vector *v = vec_create(n, sizeof(int));
+    for (size_t i = 0; i < n; i++) {
+        int x = (int)i;
+        v_push_back(v, &x);
+    }
+
+    CowVector *cv = cv_from_vector(v, 64);
+    vec_destroy(v);
+    EXPECT_TRUE(cv != NULL, "cv_from_vector");
+
+    CowSnapshot *a = cv_snapshot(cv);
+    EXPECT_EQ_SIZE(cs_size(a), n, "snapshot size");
+
+    int x = -1;
+    cv_set(cv, &x, 100);    // chunk 1
+    cv_pop_back(cv);
+    cv_push_back(cv, &x);   // last chunk
+
+    CowSnapshot *stale = cv_snapshot(cv);
+    EXPECT_TRUE(stale == a, "snapshot before publish returns the last published version");
+    cs_release(stale);
+
+    cv_publish(cv);
+    CowSnapshot *b = cv_snapshot(cv);
+
+    EXPECT_EQ_INT(*(const int *)cs_at(a, 100), 100, "old snapshot keeps old value");
+    EXPECT_EQ_INT(*(const int *)cs_at(b, 100), -1, "new snapshot sees update");
+    EXPECT_EQ_INT(*(const int *)cs_at(a, n - 1), (int)n - 1, "old snapshot keeps popped element");
+    EXPECT_EQ_INT(*(const int *)cs_at(b, n - 1), -1, "new snapshot sees pushed element");
+    EXPECT_TRUE(cs_at(a, n) == NULL, "cs_at out of bounds");
+
+    size_t count_a, count_b;
+    EXPECT_TRUE(cs_chunk(a, 0, &count_a) == cs_chunk(b, 0, &count_b), "untouched chunk is shared");
+    EXPECT_TRUE(cs_chunk(a, 1, NULL) != cs_chunk(b, 1, NULL), "written chunk is copied");
+    EXPECT_EQ_SIZE(count_a, 64, "full chunk count");
+    cs_chunk(a, (n - 1) / 64, &count_a);
+    EXPECT_EQ_SIZE(count_a, n % 64, "last chunk count");
+    EXPECT_TRUE(cs_chunk(a, (n + 63) / 64, NULL) == NULL, "cs_chunk past the end");
+
+    // Snapshots outlive the vector
+    cv_destroy(cv);
+    x = 0;
+    EXPECT_EQ_INT(cs_get(b, &x, 5), 0, "cs_get after cv_destroy");
+    EXPECT_EQ_INT(x, 5, "snapshot data after cv_destroy");
+    cs_release(a);
+    cs_release(b);
+}
+
+// 3. Readers on other threads while one writer keeps the total at zero
+typedef struct {
+    CowVector *cv;
+    atomic_int stop;
+    atomic_int bad;
+    atomic_long snapshots;
+} SharedState;
+
+static void *reader_main(void *arg) {
+    SharedState *s = arg;
+    while (!atomic_load(&s->stop)) {
+        CowSnapshot *snap = cv_snapshot(s->cv);
+        long sum = 0;
+        size_t count;
+        const int *chunk;
+        for (size_t c = 0; (chunk = cs_chunk(snap, c, &count)) != NULL; c++)
+            for (size_t i = 0; i < count; i++)
+                sum += chunk[i];
+        if (sum != 0)
+            atomic_fetch_add(&s->bad, 1);
+        cs_release(snap);
+        atomic_fetch_add(&s->snapshots, 1);
+    }
+    return NULL;
+}
+
+static void test_concurrent_readers(void) {
+    const size_t n = 20000;
+    SharedState s = { .cv = cv_create(sizeof(int), 256) };
+    atomic_init(&s.stop, 0);
+    atomic_init(&s.bad, 0);
+    atomic_init(&s.snapshots, 0);
+
+    for (size_t i = 0; i < n; i++) {
+        int zero = 0;
+        cv_push_back(s.cv, &zero);
+    }
+    cv_publish(s.cv);
+
+    pthread_t readers[3];
+    for (int i = 0; i < 3; i++)
+        pthread_create(&readers[i], NULL, reader_main, &s);
+
+    // Each published version moves some amount between two elements
+    for (int round = 0; round < 3000; round++) {
+        size_t i = (size_t)rand() % n, j = (size_t)rand() % n;
+        int d = rand() % 100 + 1;
+        *(int *)cv_at(s.cv, i) += d;
+        *(int *)cv_at(s.cv, j) -= d;
+        cv_publish(s.cv);
+    }
+
+    atomic_store(&s.stop, 1);
+    for (int i = 0; i < 3; i++)
+        pthread_join(readers[i], NULL);
+
+    EXPECT_EQ_INT(atomic_load(&s.bad), 0, "every snapshot is a consistent published version");
+    EXPECT_TRUE(atomic_load(&s.snapshots) > 0, "readers took snapshots");
+
+    cv_destroy(s.cv);
+}
+
+// 4. Publishing under continuous snapshot traffic must not wait for it to stop
+static void *snapshot_spinner(void *arg) {
+    SharedState *s = arg;
+    while (!atomic_load(&s->stop)) {
+        cs_release(cv_snapshot(s->cv));
+        atomic_fetch_add(&s->snapshots, 1);
+    }
+    return NULL;
+}
+
+static void test_publish_under_load(void) {
+    SharedState s = { .cv = cv_create(sizeof(int), 64) };
+    atomic_init(&s.stop, 0);
+    atomic_init(&s.bad, 0);
+    atomic_init(&s.snapshots, 0);
+
+    pthread_t readers[4];
+    for (int i = 0; i < 4; i++)
+        pthread_create(&readers[i], NULL, snapshot_spinner, &s);
+
+    int ok = 1;
+    for (int round = 0; round < 20000; round++) {
+        ok &= cv_push_back(s.cv, &round) == 0;
+        ok &= cv_publish(s.cv) == 0;
+    }
+
+    atomic_store(&s.stop, 1);
+    for (int i = 0; i < 4; i++)
+        pthread_join(readers[i], NULL);
+
+    CowSnapshot *snap = cv_snapshot(s.cv);
+    EXPECT_TRUE(ok, "every publish completes while readers spin");
+    EXPECT_EQ_SIZE(cs_size(snap), 20000, "last publish is visible");
+    cs_release(snap);
+
+    cv_destroy(s.cv);
+}
+
+// 5. Cost of a small update plus publish against copying the whole vector
+static void test_timed_publish(void) {
+    const size_t NUM_ELEMENTS = 4000000;
+    const int ROUNDS = 1000;
+    CowVector *cv = cv_create(sizeof(int), 0);
+    Vector *v = vec_create(NUM_ELEMENTS, sizeof(int));
+    int *copy = malloc(NUM_ELEMENTS * sizeof(int));
+    if (!cv || !v || !copy) {
+        fprintf(stderr, "[ERROR] Could not allocate memory for publish benchmark.\n");
+        cv_destroy(cv);
+        vec_destroy(v);
+        free(copy);
+        return;
+    }
+    for (size_t i = 0; i < NUM_ELEMENTS; i++) {
+        int x = rand();
+        cv_push_back(cv, &x);
+        v_push_back(v, &x);
+    }
+    cv_publish(cv);
+
+    struct timespec start, end;
+    clock_gettime(1, &start);
+    for (int r = 0; r < ROUNDS; r++) {
+        int x = r;
+        cv_set(cv, &x, (size_t)rand() % NUM_ELEMENTS);
+        cv_publish(cv);
+        cs_release(cv_snapshot(cv));
+    }
+    clock_gettime(1, &end);
+    double cow_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    for (int r = 0; r < ROUNDS; r++) {
+        int x = r;
+        v_set(v, &x, (size_t)rand() % NUM_ELEMENTS);
+        memcpy(copy, v_data(v, NULL), NUM_ELEMENTS * sizeof(int));
+    }
+    clock_gettime(1, &end);
+    double copy_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    printf("%d update+publish rounds over %zu ints: copy-on-write %.3f s, full copy %.3f s\n",
+           ROUNDS, NUM_ELEMENTS, cow_sec, copy_sec);
+
+    free(copy);
+    vec_destroy(v);
+    cv_destroy(cv);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_writer_ops();
+    test_snapshot_isolation();
+    test_concurrent_readers();
+    test_publish_under_load();
+    test_timed_publish();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
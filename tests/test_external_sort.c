@@ -0,0 +1,310 @@
+// test_external_sort.c
+// Tests for the external merge sort (ds_external_sort.h): in-memory and
+// spilled inputs checked against v_sort, records pushed from Vectors, file to
+// file sorting, and throughput with a memory budget far below the input size.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "../include/ds_external_sort.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+// 24-byte record sorted by key
+typedef struct {
+    uint64_t key;
+    uint64_t payload;
+    uint64_t check;
+} Record;
+
+static int cmp_record(void *a, void *b) {
+    uint64_t x = ((Record *)a)->key, y = ((Record *)b)->key;
+    return (x > y) - (x < y);
+}
+
+static Record make_record(size_t i) {
+    Record r;
+    r.key = ((uint64_t)rand() << 16) ^ (uint64_t)rand();
+    r.payload = i;
+    r.check = r.key * 31 + i;
+    return r;
+}
+
+// Drain the sorter and compare with v_sort of the same records
+static int drain_matches(ExtSorter *s, Vector *expect) {
+    v_sort(expect, cmp_record);
+
+    size_t n, i = 0;
+    Record *ref = v_data(expect, &n);
+    Record r;
+    int ok = 1, rc;
+
+    while ((rc = ext_next(s, &r)) == 0) {
+        ok &= i < n && r.key == ref[i].key && r.check == r.key * 31 + r.payload;
+        i++;
+    }
+
+    return ok && rc == 1 && i == n;
+}
+
+// 1. Invalid input
+static void test_invalid_input(void) {
+    Record r = { 0, 0, 0 };
+
+    EXPECT_TRUE(ext_create(0, cmp_record, NULL) == NULL, "create with zero data_size");
+    EXPECT_TRUE(ext_create(sizeof(Record), NULL, NULL) == NULL, "create without comparator");
+
+    ExtSorter *s = ext_create(sizeof(Record), cmp_record, NULL);
+    EXPECT_EQ_INT(ext_next(s, &r), -1, "next before finish");
+    EXPECT_EQ_INT(ext_push(s, NULL), -1, "push without record");
+
+    Vector *wrong = vec_create(4, sizeof(int));
+    EXPECT_EQ_INT(ext_push_vector(s, wrong), -1, "push vector with other data_size");
+    vec_destroy(wrong);
+
+    EXPECT_EQ_INT(ext_finish(s), 0, "finish empty sorter");
+    EXPECT_EQ_INT(ext_next(s, &r), 1, "empty sorter yields nothing");
+    EXPECT_EQ_INT(ext_finish(s), -1, "finish twice");
+    EXPECT_EQ_INT(ext_push(s, &r), -1, "push after finish");
+    ext_destroy(s);
+
+    EXPECT_EQ_INT(ext_sort_file("/nonexistent/in", "/nonexistent/out", 8, cmp_record, NULL), -2,
+                  "sort missing file");
+}
+
+// 2. Inputs that fit in memory, and inputs split into many spilled runs
+static void test_against_v_sort(void) {
+    static const size_t sizes[] = { 1, 100, 5000, 100000 };
+    ExtSortOptions opts = { .memory_budget = 64 * 1024, .io_buffer = 4096 };
+
+    for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); t++) {
+        size_t n = sizes[t];
+        ExtSorter *s = ext_create(sizeof(Record), cmp_record, &opts);
+        Vector *expect = vec_create(n, sizeof(Record));
+
+        int ok = 1;
+        for (size_t i = 0; i < n; i++) {
+            Record r = make_record(i);
+            if (i % 10 == 0) r.key = 42;    // plenty of equal keys
+            r.check = r.key * 31 + i;
+            ok &= ext_push(s, &r) == 0;
+            v_push_back(expect, &r);
+        }
+        EXPECT_TRUE(ok, "push");
+        EXPECT_EQ_INT(ext_finish(s), 0, "finish");
+        if (n * sizeof(Record) <= opts.memory_budget / 2)
+            EXPECT_EQ_SIZE(ext_num_runs(s), 0, "small input is not spilled");
+        else
+            EXPECT_TRUE(ext_num_runs(s) > 1, "large input is spilled to several runs");
+        EXPECT_TRUE(drain_matches(s, expect), "output matches v_sort");
+
+        vec_destroy(expect);
+        ext_destroy(s);
+    }
+}
+
+// 3. Presorted and all-equal input, spilled and held in memory, must sort in n log n
+static void test_degenerate_input(void) {
+    const size_t n = 500000;
+    ExtSortOptions spill = { .memory_budget = 1024 * 1024 };
+    const ExtSortOptions *options[] = { &spill, NULL };
+    const char *shapes[] = { "ascending keys", "all-equal keys" };
+
+    for (int o = 0; o < 2; o++) {
+        for (int shape = 0; shape < 2; shape++) {
+            ExtSorter *s = ext_create(sizeof(Record), cmp_record, options[o]);
+            Vector *expect = vec_create(n, sizeof(Record));
+
+            struct timespec start, end;
+            clock_gettime(1, &start);
+            int ok = 1;
+            for (size_t i = 0; i < n; i++) {
+                Record r = { shape == 0 ? i : 7, i, 0 };
+                r.check = r.key * 31 + i;
+                ok &= ext_push(s, &r) == 0;
+                v_push_back(expect, &r);
+            }
+            ok &= ext_finish(s) == 0;
+            clock_gettime(1, &end);
+            double sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+            EXPECT_TRUE(ok, shapes[shape]);
+            EXPECT_TRUE(drain_matches(s, expect), shapes[shape]);
+            EXPECT_TRUE(sec < 10.0, "run sorting is not quadratic");
+
+            vec_destroy(expect);
+            ext_destroy(s);
+        }
+    }
+}
+
+// 4. A producer hands over batches in a Vector that it reuses
+static void test_push_vector(void) {
+    ExtSortOptions opts = { .memory_budget = 32 * 1024 };
+    ExtSorter *s = ext_create(sizeof(Record), cmp_record, &opts);
+    Vector *batch = vec_create(1000, sizeof(Record));
+    Vector *expect = vec_create(1000, sizeof(Record));
+
+    for (int round = 0; round < 20; round++) {
+        v_clear(batch);
+        for (size_t i = 0; i < 1000; i++) {
+            Record r = make_record(round * 1000 + i);
+            v_push_back(batch, &r);
+            v_push_back(expect, &r);
+        }
+        EXPECT_EQ_INT(ext_push_vector(s, batch), 0, "push_vector");
+    }
+
+    EXPECT_EQ_INT(ext_finish(s), 0, "finish after push_vector");
+    EXPECT_TRUE(drain_matches(s, expect), "push_vector output matches v_sort");
+
+    // Destroying before draining releases the runs
+    ext_destroy(s);
+    vec_destroy(batch);
+    vec_destroy(expect);
+}
+
+static char *temp_path(const char *name) {
+    const char *dir = getenv("TMPDIR");
+    char *path = malloc(512);
+    snprintf(path, 512, "%s/%s_%ld", dir && *dir ? dir : "/tmp", name, (long)getpid());
+    return path;
+}
+
+// 5. File to file
+static void test_sort_file(void) {
+    const size_t n = 50000;
+    char *in_path = temp_path("ds_extsort_in");
+    char *out_path = temp_path("ds_extsort_out");
+    Vector *expect = vec_create(n, sizeof(Record));
+
+    FILE *in = fopen(in_path, "wb");
+    for (size_t i = 0; i < n; i++) {
+        Record r = make_record(i);
+        fwrite(&r, sizeof(r), 1, in);
+        v_push_back(expect, &r);
+    }
+    fclose(in);
+
+    ExtSortOptions opts = { .memory_budget = 128 * 1024, .io_buffer = 16 * 1024 };
+    EXPECT_EQ_INT(ext_sort_file(in_path, out_path, sizeof(Record), cmp_record, &opts), 0, "sort_file");
+
+    v_sort(expect, cmp_record);
+    Record *ref = v_data(expect, NULL);
+    FILE *out = fopen(out_path, "rb");
+    Record r;
+    size_t i = 0;
+    int ok = out != NULL;
+    while (ok && fread(&r, sizeof(r), 1, out) == 1) {
+        ok &= i < n && r.key == ref[i].key && r.check == r.key * 31 + r.payload;
+        i++;
+    }
+    if (out) fclose(out);
+    EXPECT_TRUE(ok, "sorted file contents");
+    EXPECT_EQ_SIZE(i, n, "sorted file length");
+
+    EXPECT_EQ_INT(ext_sort_file(in_path, out_path, 7, cmp_record, NULL), -1, "partial trailing record");
+
+    remove(in_path);
+    remove(out_path);
+    free(in_path);
+    free(out_path);
+    vec_destroy(expect);
+}
+
+// 6. Sorting 16x the memory budget against an in-memory v_sort
+static void test_timed_external(void) {
+    const size_t NUM_RECORDS = 4000000;
+    ExtSortOptions opts = { .memory_budget = NUM_RECORDS * sizeof(Record) / 16 };
+    ExtSorter *s = ext_create(sizeof(Record), cmp_record, &opts);
+    Vector *v = vec_create(NUM_RECORDS, sizeof(Record));
+    if (!s || !v) {
+        fprintf(stderr, "[ERROR] Could not allocate memory for external sort benchmark.\n");
+        ext_destroy(s);
+        vec_destroy(v);
+        return;
+    }
+
+    struct timespec start, end;
+    clock_gettime(1, &start);
+    for (size_t i = 0; i < NUM_RECORDS; i++) {
+        Record r = make_record(i);
+        ext_push(s, &r);
+        v_push_back(v, &r);
+    }
+    ext_finish(s);
+    Record r;
+    uint64_t prev = 0;
+    int ok = 1;
+    while (ext_next(s, &r) == 0) {
+        ok &= r.key >= prev;
+        prev = r.key;
+    }
+    clock_gettime(1, &end);
+    double ext_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    EXPECT_TRUE(ok, "benchmark output is sorted");
+
+    clock_gettime(1, &start);
+    v_sort(v, cmp_record);
+    clock_gettime(1, &end);
+    double mem_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    printf("External sort of %zu records (%zu runs, budget %zu KB): %.3f s; in-memory v_sort: %.3f s\n",
+           NUM_RECORDS, ext_num_runs(s), opts.memory_budget / 1024, ext_sec, mem_sec);
+
+    vec_destroy(v);
+    ext_destroy(s);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_against_v_sort();
+    test_degenerate_input();
+    test_push_vector();
+    test_sort_file();
+    test_timed_external();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,243 @@
+// test_flat_map.c
+// Tests for the sorted flat map/set (ds_flat_map.h): random operations checked
+// against a direct-indexed reference, bulk inserts with duplicate keys, ordered
+// iteration, and lookup speed compared with the AVL tree.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_flat_map.h"
+#include "../include/ds_tree.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+typedef struct {
+    int32_t key;
+    int64_t value;
+} Entry;
+
+static int cmp_key(void *a, void *b) {
+    int32_t x = *(int32_t *)a, y = *(int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// 1. Invalid input and empty map
+static void test_invalid_input(void) {
+    FlatMap *map = fm_create(sizeof(Entry), cmp_key);
+    int32_t k = 1;
+    size_t index;
+
+    EXPECT_TRUE(fm_create(0, cmp_key) == NULL, "create with zero entry_size");
+    EXPECT_TRUE(fm_create(sizeof(Entry), NULL) == NULL, "create without comparator");
+    EXPECT_EQ_INT(fm_insert(map, NULL), -1, "insert without entry");
+    EXPECT_EQ_INT(fm_insert(NULL, &k), -1, "insert on NULL map");
+    EXPECT_TRUE(fm_find(map, &k) == NULL, "find in empty map");
+    EXPECT_EQ_INT(fm_contains(map, &k), 0, "contains in empty map");
+    EXPECT_EQ_INT(fm_erase(map, &k), 1, "erase from empty map");
+    EXPECT_EQ_INT(fm_lower_bound(map, &k, &index), 0, "lower_bound in empty map");
+    EXPECT_EQ_SIZE(index, 0, "lower_bound index in empty map");
+    EXPECT_EQ_SIZE(fm_size(map), 0, "size of empty map");
+
+    fm_destroy(map);
+}
+
+// 2. Random insert/update/erase against a direct-indexed reference
+static void test_random_ops(void) {
+    enum { KEY_RANGE = 2000, OPS = 40000 };
+    FlatMap *map = fm_create(sizeof(Entry), cmp_key);
+    int present[KEY_RANGE] = { 0 };
+    int64_t values[KEY_RANGE];
+    size_t expect_size = 0;
+    int ok = 1;
+
+    for (int op = 0; op < OPS; op++) {
+        int32_t k = rand() % KEY_RANGE;
+        if (rand() % 4) {
+            Entry e = { k, (int64_t)rand() * 7 };
+            ok &= fm_insert(map, &e) == (present[k] ? 1 : 0);
+            if (!present[k]) expect_size++;
+            present[k] = 1;
+            values[k] = e.value;
+        } else {
+            ok &= fm_erase(map, &k) == (present[k] ? 0 : 1);
+            if (present[k]) expect_size--;
+            present[k] = 0;
+        }
+
+        if (op % 97 == 0) {
+            int32_t probe = rand() % KEY_RANGE;
+            Entry *found = fm_find(map, &probe);
+            ok &= present[probe] ? (found && found->value == values[probe]) : found == NULL;
+        }
+    }
+    EXPECT_TRUE(ok, "insert/erase return codes and interleaved finds");
+    EXPECT_EQ_SIZE(fm_size(map), expect_size, "size matches reference");
+
+    ok = 1;
+    for (int32_t k = 0; k < KEY_RANGE; k++) {
+        Entry *found = fm_find(map, &k);
+        ok &= present[k] ? (found && found->key == k && found->value == values[k]) : found == NULL;
+    }
+    EXPECT_TRUE(ok, "every key matches reference");
+
+    // Ordered iteration is a plain walk over the sorted entries
+    size_t count;
+    Entry *entries = fm_data(map, &count);
+    EXPECT_EQ_SIZE(count, expect_size, "fm_data count");
+    ok = 1;
+    for (size_t i = 1; i < count; i++)
+        ok &= entries[i - 1].key < entries[i].key;
+    EXPECT_TRUE(ok, "entries in key order");
+
+    int32_t probe = KEY_RANGE / 2;
+    size_t index;
+    fm_lower_bound(map, &probe, &index);
+    EXPECT_TRUE(index == count || entries[index].key >= probe, "lower_bound points at first key >= probe");
+    EXPECT_TRUE(index == 0 || entries[index - 1].key < probe, "lower_bound is the first such key");
+
+    EXPECT_EQ_INT(fm_clear(map), 0, "clear");
+    EXPECT_EQ_SIZE(fm_size(map), 0, "size after clear");
+    fm_destroy(map);
+}
+
+// 3. Bulk insert with duplicates inside the batch and against existing keys
+static void test_bulk_insert(void) {
+    FlatMap *map = fm_create(sizeof(Entry), cmp_key);
+
+    for (int32_t k = 0; k < 100; k += 2) {
+        Entry e = { k, -k };
+        fm_insert(map, &e);
+    }
+
+    Entry batch[300];
+    for (int i = 0; i < 300; i++) {
+        batch[i].key = (i * 37) % 150;
+        batch[i].value = i;
+    }
+    EXPECT_EQ_INT(fm_insert_bulk(map, batch, 300), 0, "insert_bulk return code");
+    EXPECT_EQ_SIZE(fm_size(map), 150, "bulk insert merges duplicates");
+
+    int ok = 1;
+    for (int32_t k = 0; k < 150; k++) {
+        int64_t last = -1;
+        for (int i = 0; i < 300; i++)
+            if (batch[i].key == k) last = i;
+        Entry *found = fm_find(map, &k);
+        ok &= found && found->value == last;
+    }
+    EXPECT_TRUE(ok, "last value in the batch wins");
+
+    fm_destroy(map);
+}
+
+// 4. A set stores entries that are only a key
+static void test_set(void) {
+    FlatMap *set = fm_create(sizeof(int32_t), cmp_key);
+    for (int32_t k = 50; k > 0; k--)
+        EXPECT_EQ_INT(fm_insert(set, &k), 0, "set insert");
+    int32_t k = 7;
+    EXPECT_EQ_INT(fm_insert(set, &k), 1, "set insert of existing key");
+    EXPECT_EQ_INT(fm_contains(set, &k), 1, "set contains");
+    EXPECT_TRUE(*(int32_t *)fm_find(set, &k) == 7, "set find returns the stored key");
+
+    size_t count;
+    int32_t *keys = fm_data(set, &count);
+    EXPECT_EQ_SIZE(count, 50, "set size");
+    EXPECT_TRUE(keys[0] == 1 && keys[49] == 50, "set keys in order");
+
+    fm_destroy(set);
+}
+
+// 5. Lookups in a flat map against the AVL tree
+static int cmp_int(void *a, void *b) {
+    int x = *(int *)a, y = *(int *)b;
+    return (x > y) - (x < y);
+}
+
+static void test_timed_lookup(void) {
+    const int NUM_KEYS = 200000;
+    const int LOOKUPS = 2000000;
+    int *keys = malloc(NUM_KEYS * sizeof(int));
+    FlatMap *map = fm_create(sizeof(int), cmp_int);
+    AVL_Tree *tree = avl_create(sizeof(int), 1, cmp_int);
+
+    for (int i = 0; i < NUM_KEYS; i++) {
+        keys[i] = rand();
+        tree_insert(tree, keys[i]);
+    }
+    fm_insert_bulk(map, keys, NUM_KEYS);
+
+    struct timespec start, end;
+    long hits_map = 0, hits_tree = 0;
+
+    clock_gettime(1, &start);
+    for (int i = 0; i < LOOKUPS; i++)
+        hits_map += fm_find(map, &keys[((size_t)i * 7919) % NUM_KEYS]) != NULL;
+    clock_gettime(1, &end);
+    double map_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    for (int i = 0; i < LOOKUPS; i++)
+        hits_tree += tree_search(tree, keys[((size_t)i * 7919) % NUM_KEYS]) != NULL;
+    clock_gettime(1, &end);
+    double tree_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    EXPECT_TRUE(hits_map == LOOKUPS && hits_tree == LOOKUPS, "all lookups hit");
+    printf("%d lookups over %d keys: FlatMap %.3f s, AVL_Tree %.3f s\n",
+           LOOKUPS, NUM_KEYS, map_sec, tree_sec);
+
+    avl_destroy(tree);
+    fm_destroy(map);
+    free(keys);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_random_ops();
+    test_bulk_insert();
+    test_set();
+    test_timed_lookup();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
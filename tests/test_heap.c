@@ -1,7 +1,9 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
 
 #include "../include/ds_heap.h"
+#include "../include/ds_heap_typed.h"
 
 // For a min-heap: return 1 if child < parent
 int int_min_compare(const void *arr, int child_idx, int parent_idx) {
@@ -112,6 +114,322 @@ void test_large_input_stress() {
     printf("test_large_input_stress passed\n");
 }
 
+// Pop everything and check that values come out in non-decreasing order
+static int drains_sorted(Heap *heap, int expected_count) {
+    int prev = -2147483647 - 1, curr, count = 0;
+    while (hp_get_size(heap) > 0) {
+        hp_peek(heap, &curr);
+        if (curr < prev)
+            return 0;
+        prev = curr;
+        hp_remove_top(heap);
+        count++;
+    }
+    return count == expected_count;
+}
+
+void test_build_from_array() {
+    int values[] = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0, 4, 7};
+    int n = sizeof(values) / sizeof(values[0]);
+
+    Heap *heap = hp_from_array(sizeof(int), values, n, int_min_compare);
+    assert(heap != NULL);
+    assert(hp_get_size(heap) == n);
+    assert(values[0] == 9); // source array is copied, not reordered
+
+    // The heap keeps growing after construction
+    heap_insert(heap, int, -1);
+    assert(drains_sorted(heap, n + 1));
+    hp_destroy(heap);
+
+    // Empty input gives an empty heap that can still be filled
+    heap = hp_from_array(sizeof(int), NULL, 0, int_min_compare);
+    assert(heap != NULL && hp_get_size(heap) == 0);
+    heap_insert(heap, int, 3);
+    assert(hp_get_size(heap) == 1);
+    hp_destroy(heap);
+
+    // A single element is already a heap
+    heap = hp_from_array(sizeof(int), values, 1, int_min_compare);
+    assert(heap != NULL && drains_sorted(heap, 1));
+    hp_destroy(heap);
+
+    assert(hp_from_array(sizeof(int), NULL, 3, int_min_compare) == NULL);
+    assert(hp_from_array(0, values, n, int_min_compare) == NULL);
+    assert(hp_from_array(sizeof(int), values, n, NULL) == NULL);
+    printf("test_build_from_array passed\n");
+}
+
+void test_build_adopts_buffer() {
+    int n = 100000;
+    int *buffer = malloc(n * sizeof(int));
+    for (int i = 0; i < n; ++i)
+        buffer[i] = rand() % 1000;
+
+    // The heap owns the buffer from here on
+    Heap *heap = hp_build(sizeof(int), buffer, n, int_min_compare);
+    assert(heap != NULL);
+    assert(hp_get_size(heap) == n);
+    heap_insert(heap, int, 5);
+    assert(drains_sorted(heap, n + 1));
+    hp_destroy(heap);
+
+    assert(hp_build(sizeof(int), NULL, 4, int_min_compare) == NULL);
+    printf("test_build_adopts_buffer passed\n");
+}
+
+void test_build_from_vector() {
+    Vector *vec = vec_create(16, sizeof(int));
+    for (int i = 0; i < 1000; ++i) {
+        int v = (i * 7919) % 1000;
+        v_push_back(vec, &v);
+    }
+
+    Heap *heap = hp_from_vector(vec, int_min_compare);
+    assert(heap != NULL);
+    assert(hp_get_size(heap) == 1000);
+    assert(v_size(vec) == 1000); // the Vector is left as it was
+
+    int top;
+    hp_peek(heap, &top);
+    assert(top == 0);
+    assert(drains_sorted(heap, 1000));
+
+    hp_destroy(heap);
+    vec_destroy(vec);
+    assert(hp_from_vector(NULL, int_min_compare) == NULL);
+    printf("test_build_from_vector passed\n");
+}
+
+typedef struct {
+    int key;
+    int payload[7];
+} Job;
+
+int job_min_compare(const void *arr, int child_idx, int parent_idx) {
+    const Job *a = (const Job *)arr;
+    return a[child_idx].key < a[parent_idx].key;
+}
+
+void test_struct_elements_stay_intact() {
+    Heap *heap = hp_init(sizeof(Job), 2, job_min_compare);
+    for (int i = 0; i < 5000; ++i) {
+        Job job;
+        job.key = rand() % 500;
+        for (int j = 0; j < 7; ++j)
+            job.payload[j] = job.key * 7 + j;
+        hp__insert_internal(heap, &job);
+
+        // Interleave removals so holes open at every depth
+        if (i % 3 == 0)
+            hp_remove_top(heap);
+    }
+
+    Job prev = {-1, {0}}, curr;
+    while (hp_get_size(heap)) {
+        hp_peek(heap, &curr);
+        assert(curr.key >= prev.key);
+        for (int j = 0; j < 7; ++j)
+            assert(curr.payload[j] == curr.key * 7 + j);
+        prev = curr;
+        hp_remove_top(heap);
+    }
+
+    hp_destroy(heap);
+    printf("test_struct_elements_stay_intact passed\n");
+}
+
+void test_dary_heaps() {
+    int arities[] = {2, 4, 8};
+
+    for (int a = 0; a < 3; ++a) {
+        // 4- and 32-byte elements, both cache-aligned when the arity is above 2
+        Heap *heap = hp_init_dary(sizeof(int), 1, arities[a], int_min_compare);
+        Heap *jobs = hp_init_dary(sizeof(Job), 1, arities[a], job_min_compare);
+        assert(heap != NULL && jobs != NULL);
+
+        for (int i = 0; i < 20000; ++i) {
+            int v = rand() % 10000;
+            heap_insert(heap, int, v);
+
+            Job job = {v, {0}};
+            hp__insert_internal(jobs, &job);
+            if (i % 4 == 0) {
+                hp_remove_top(heap);
+                hp_remove_top(jobs);
+            }
+        }
+        assert(hp_get_size(heap) == 15000);
+        assert(drains_sorted(heap, 15000));
+
+        Job prev = {-1, {0}}, curr;
+        while (hp_get_size(jobs)) {
+            hp_peek(jobs, &curr);
+            assert(curr.key >= prev.key);
+            prev = curr;
+            hp_remove_top(jobs);
+        }
+
+        hp_destroy(heap);
+        hp_destroy(jobs);
+    }
+
+    assert(hp_init_dary(sizeof(int), 10, 3, int_min_compare) == NULL);
+    assert(hp_init_dary(sizeof(int), 10, 1, int_min_compare) == NULL);
+    printf("test_dary_heaps passed\n");
+}
+
+// Pointer-based comparator for a max-heap of Jobs
+int job_max_elem_compare(const void *a, const void *b) {
+    return ((const Job *)a)->key > ((const Job *)b)->key;
+}
+
+void test_elem_compare() {
+    Heap *heap = hp_init_elem(sizeof(Job), 4, 4, job_max_elem_compare);
+    assert(heap != NULL);
+
+    for (int i = 0; i < 1000; ++i) {
+        Job job = {(i * 37) % 1000, {i}};
+        hp__insert_internal(heap, &job);
+    }
+
+    Job curr;
+    for (int expected = 999; expected >= 0; --expected) {
+        hp_peek(heap, &curr);
+        assert(curr.key == expected);
+        hp_remove_top(heap);
+    }
+    assert(hp_get_size(heap) == 0);
+    hp_destroy(heap);
+
+    assert(hp_init_elem(sizeof(Job), 4, 2, NULL) == NULL);
+    printf("test_elem_compare passed\n");
+}
+
+#define INT_LESS(a, b) ((a) < (b))
+DS_HEAP_DEFINE(IntHeap, int, INT_LESS)
+
+#define JOB_KEY_GREATER(a, b) ((a).key > (b).key)
+DS_HEAP_DEFINE(JobMaxHeap, Job, JOB_KEY_GREATER)
+
+void test_typed_heap() {
+    IntHeap *heap = IntHeap_create(1);
+    int top;
+    assert(IntHeap_pop(heap, &top) == -1);
+    assert(IntHeap_peek(heap, &top) == -1);
+
+    for (int i = 0; i < 10000; ++i)
+        assert(IntHeap_push(heap, rand() % 5000) == 0);
+    assert(IntHeap_size(heap) == 10000);
+
+    int prev = -1;
+    while (IntHeap_pop(heap, &top) == 0) {
+        assert(top >= prev);
+        prev = top;
+    }
+    assert(IntHeap_size(heap) == 0);
+    IntHeap_destroy(heap);
+    assert(IntHeap_create(0) == NULL);
+
+    JobMaxHeap *jobs = JobMaxHeap_create(8);
+    for (int i = 0; i < 100; ++i) {
+        Job job = {i % 10, {i}};
+        JobMaxHeap_push(jobs, job);
+    }
+    Job job;
+    JobMaxHeap_peek(jobs, &job);
+    assert(job.key == 9);
+    JobMaxHeap_pop(jobs, NULL);
+    assert(JobMaxHeap_size(jobs) == 99);
+
+    Job low = {-1, {0}}, high = {100, {0}};
+    JobMaxHeap_pushpop(jobs, high, &job);
+    assert(job.key == 100); // would be the top, comes straight back
+    JobMaxHeap_pushpop(jobs, low, &job);
+    assert(job.key == 9 && JobMaxHeap_size(jobs) == 99);
+    assert(JobMaxHeap_pushpop(jobs, low, NULL) == -1); // like hp_pushpop
+    assert(JobMaxHeap_size(jobs) == 99);
+    JobMaxHeap_replace_top(jobs, high, &job);
+    assert(job.key == 9);
+    JobMaxHeap_peek(jobs, &job);
+    assert(job.key == 100);
+    JobMaxHeap_destroy(jobs);
+    printf("test_typed_heap passed\n");
+}
+
+void test_pop_and_pop_n() {
+    int values[] = {7, 3, 9, 1, 5, 8, 2};
+    Heap *heap = hp_from_array(sizeof(int), values, 7, int_min_compare);
+
+    int top;
+    assert(hp_pop(heap, &top) == 0 && top == 1);
+    assert(hp_pop(heap, NULL) == 0); // discards 2
+    assert(hp_get_size(heap) == 5);
+
+    int out[8];
+    assert(hp_pop_n(heap, out, 3) == 3);
+    assert(out[0] == 3 && out[1] == 5 && out[2] == 7);
+    assert(hp_pop_n(heap, out, 8) == 2); // only two left
+    assert(out[0] == 8 && out[1] == 9);
+    assert(hp_pop(heap, &top) == -1);
+    assert(hp_pop_n(heap, out, 4) == 0);
+    assert(hp_pop_n(heap, NULL, 4) == -1);
+
+    hp_destroy(heap);
+    printf("test_pop_and_pop_n passed\n");
+}
+
+void test_pushpop_and_replace_top() {
+    Heap *heap = hp_init(sizeof(int), 4, int_min_compare);
+    int out, in;
+
+    // Empty heap: the pushed item comes straight back
+    in = 5;
+    assert(hp_pushpop(heap, &in, &out) == 0 && out == 5);
+    assert(hp_get_size(heap) == 0);
+    assert(hp_replace_top(heap, &in, &out) == -1);
+
+    heap_insert(heap, int, 10);
+    heap_insert(heap, int, 20);
+    heap_insert(heap, int, 30);
+
+    in = 4; // would be the new top
+    assert(hp_pushpop(heap, &in, &out) == 0 && out == 4);
+    in = 25;
+    assert(hp_pushpop(heap, &in, &out) == 0 && out == 10);
+    assert(hp_get_size(heap) == 3);
+
+    in = 1; // replace_top always pops first, even if the new item is smaller
+    assert(hp_replace_top(heap, &in, &out) == 0 && out == 20);
+    in = 40;
+    assert(hp_replace_top(heap, &in, &in) == 0 && in == 1); // dest may alias data
+    assert(hp_get_size(heap) == 3);
+
+    int expected[] = {25, 30, 40};
+    for (int i = 0; i < 3; ++i) {
+        assert(hp_pop(heap, &out) == 0 && out == expected[i]);
+    }
+    hp_destroy(heap);
+
+    // Streaming top-k: keep the 100 largest of 100000 values in a min-heap
+    Heap *topk = hp_init(sizeof(int), 100, int_min_compare);
+    int counts[1000] = {0};
+    for (int i = 0; i < 100000; ++i) {
+        int v = rand() % 1000;
+        counts[v]++;
+        if (hp_get_size(topk) < 100)
+            heap_insert(topk, int, v);
+        else
+            hp_pushpop(topk, &v, &out);
+    }
+    int kth = 999, seen = 0;
+    while (seen + counts[kth] < 100)
+        seen += counts[kth--];
+    assert(hp_peek(topk, &out) == 0 && out == kth);
+    hp_destroy(topk);
+    printf("test_pushpop_and_replace_top passed\n");
+}
+
 // ============================= Main ==============================
 
 int main() {
@@ -121,6 +439,15 @@ int main() {
     test_dynamic_size_reporting();
     test_peek_and_remove_on_empty_heap();
     test_large_input_stress();
+    test_build_from_array();
+    test_build_adopts_buffer();
+    test_build_from_vector();
+    test_struct_elements_stay_intact();
+    test_dary_heaps();
+    test_elem_compare();
+    test_typed_heap();
+    test_pop_and_pop_n();
+    test_pushpop_and_replace_top();
     printf("All tests passed successfully!\n");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,328 @@
+// test_indexed_heap.c
+// Tests for the indexed heap (ds_indexed_heap.h): handles across pops and
+// reuse, priority updates and removals checked against a brute-force model,
+// and Dijkstra with decrease-key against Heap with lazily skipped duplicates.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_indexed_heap.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+typedef struct {
+    uint64_t dist;
+    uint32_t node;
+} Entry;
+
+static int entry_less(const void *a, const void *b) {
+    return ((const Entry *)a)->dist < ((const Entry *)b)->dist;
+}
+
+static int int_less(const void *a, const void *b) {
+    return *(const int *)a < *(const int *)b;
+}
+
+// 1. Invalid input and empty heap
+static void test_invalid_input(void) {
+    int v = 1;
+    size_t h;
+
+    EXPECT_TRUE(ih_create(0, 4, int_less) == NULL, "zero data_size");
+    EXPECT_TRUE(ih_create(sizeof(int), 4, NULL) == NULL, "no comparator");
+
+    IndexedHeap *heap = ih_create(sizeof(int), 0, int_less);
+    EXPECT_EQ_INT(ih_pop(heap, &v, NULL), 1, "pop empty");
+    EXPECT_EQ_INT(ih_peek(heap, &v, NULL), 1, "peek empty");
+    EXPECT_EQ_INT(ih_insert(heap, NULL, &h), -1, "insert NULL");
+    EXPECT_EQ_INT(ih_update_priority(heap, 0, &v), -1, "update unknown handle");
+    EXPECT_EQ_INT(ih_remove(heap, 7, NULL), -1, "remove unknown handle");
+
+    EXPECT_EQ_INT(ih_insert(heap, &v, &h), 0, "insert");
+    EXPECT_EQ_INT(ih_pop(heap, NULL, NULL), 0, "pop");
+    EXPECT_TRUE(!ih_contains(heap, h), "popped handle is released");
+    EXPECT_EQ_INT(ih_get(heap, h, &v), -1, "get released handle");
+    EXPECT_TRUE(ih_at(heap, h) == NULL, "at released handle");
+
+    ih_destroy(heap);
+    ih_destroy(NULL);
+}
+
+// 2. Random inserts, updates, removes and pops against a brute-force model
+static void test_against_model(void) {
+    enum { MAX_HANDLES = 4096 };
+    static int model[MAX_HANDLES];
+    static int live[MAX_HANDLES];
+    memset(live, 0, sizeof(live));
+
+    IndexedHeap *heap = ih_create(sizeof(int), 4, int_less);
+    size_t live_count = 0;
+    int ok = 1;
+
+    for (int step = 0; step < 200000 && ok; step++) {
+        int op = rand() % 10;
+
+        if ((op < 4 && live_count < MAX_HANDLES / 2) || live_count == 0) {
+            int v = rand() % 100000;
+            size_t h;
+            ok &= ih_insert(heap, &v, &h) == 0 && h < MAX_HANDLES && !live[h];
+            model[h] = v;
+            live[h] = 1;
+            live_count++;
+            continue;
+        }
+
+        // Pick a random live handle
+        size_t h = (size_t)rand() % MAX_HANDLES;
+        while (!live[h])
+            h = (h + 1) % MAX_HANDLES;
+
+        if (op < 7) {
+            int v = rand() % 100000;
+            ok &= ih_update_priority(heap, h, &v) == 0;
+            model[h] = v;
+        } else if (op < 8) {
+            int got;
+            ok &= ih_remove(heap, h, &got) == 0 && got == model[h];
+            live[h] = 0;
+            live_count--;
+        } else {
+            int min = 1 << 30;
+            for (size_t i = 0; i < MAX_HANDLES; i++)
+                if (live[i] && model[i] < min)
+                    min = model[i];
+
+            int got;
+            size_t got_handle;
+            ok &= ih_pop(heap, &got, &got_handle) == 0 && got == min;
+            ok &= live[got_handle] && model[got_handle] == got;
+            live[got_handle] = 0;
+            live_count--;
+        }
+
+        ok &= ih_size(heap) == live_count;
+    }
+
+    EXPECT_TRUE(ok, "operations match the model");
+
+    // In-place change through ih_at, then a re-sift
+    if (live_count > 0) {
+        size_t h = 0;
+        while (!live[h])
+            h++;
+        *(int *)ih_at(heap, h) = -5;
+        EXPECT_EQ_INT(ih_update_priority(heap, h, NULL), 0, "update after in-place change");
+        size_t top;
+        ih_peek(heap, NULL, &top);
+        EXPECT_EQ_SIZE(top, h, "changed element is the new top");
+    }
+
+    EXPECT_EQ_INT(ih_clear(heap), 0, "clear");
+    EXPECT_EQ_SIZE(ih_size(heap), 0, "empty after clear");
+    ih_destroy(heap);
+}
+
+typedef struct {
+    uint32_t *first;    // edges of node u are first[u] .. first[u + 1]
+    uint32_t *target;
+    uint32_t *weight;
+    uint32_t nodes;
+} Graph;
+
+static Graph make_graph(uint32_t nodes, uint32_t degree) {
+    Graph g;
+    g.nodes = nodes;
+    g.first = malloc((nodes + 1) * sizeof(uint32_t));
+    g.target = malloc((size_t)nodes * degree * sizeof(uint32_t));
+    g.weight = malloc((size_t)nodes * degree * sizeof(uint32_t));
+
+    for (uint32_t u = 0; u <= nodes; u++)
+        g.first[u] = u * degree;
+    for (size_t e = 0; e < (size_t)nodes * degree; e++) {
+        g.target[e] = (uint32_t)(((size_t)rand() * RAND_MAX + rand()) % nodes);
+        g.weight[e] = 1 + (uint32_t)(rand() % 1000);
+    }
+    return g;
+}
+
+static void free_graph(Graph *g) {
+    free(g->first);
+    free(g->target);
+    free(g->weight);
+}
+
+// Dijkstra with one heap entry per node, lowered in place
+static void dijkstra_indexed(Graph *g, uint64_t *dist) {
+    IndexedHeap *heap = ih_create(sizeof(Entry), 1024, entry_less);
+    size_t *handle = malloc(g->nodes * sizeof(size_t));
+    char *state = calloc(g->nodes, 1); // 0 unseen, 1 queued, 2 done
+
+    for (uint32_t u = 0; u < g->nodes; u++)
+        dist[u] = UINT64_MAX;
+
+    Entry e = { 0, 0 };
+    dist[0] = 0;
+    ih_insert(heap, &e, &handle[0]);
+    state[0] = 1;
+
+    while (ih_pop(heap, &e, NULL) == 0) {
+        state[e.node] = 2;
+        for (uint32_t i = g->first[e.node]; i < g->first[e.node + 1]; i++) {
+            uint32_t v = g->target[i];
+            uint64_t d = e.dist + g->weight[i];
+            if (state[v] == 2 || d >= dist[v])
+                continue;
+
+            dist[v] = d;
+            Entry next = { d, v };
+            if (state[v] == 1)
+                ih_update_priority(heap, handle[v], &next);
+            else {
+                ih_insert(heap, &next, &handle[v]);
+                state[v] = 1;
+            }
+        }
+    }
+
+    ih_destroy(heap);
+    free(handle);
+    free(state);
+}
+
+static int entry_min_compare(const void *arr, int child_idx, int parent_idx) {
+    const Entry *a = (const Entry *)arr;
+    return a[child_idx].dist < a[parent_idx].dist;
+}
+
+// Dijkstra pushing a new entry on every improvement and skipping stale ones
+static int dijkstra_lazy(Graph *g, uint64_t *dist) {
+    Heap *heap = hp_init(sizeof(Entry), 1024, entry_min_compare);
+    int max_size = 0;
+
+    for (uint32_t u = 0; u < g->nodes; u++)
+        dist[u] = UINT64_MAX;
+
+    Entry e = { 0, 0 };
+    dist[0] = 0;
+    hp__insert_internal(heap, &e);
+
+    while (hp_pop(heap, &e) == 0) {
+        if (e.dist > dist[e.node])
+            continue;
+        for (uint32_t i = g->first[e.node]; i < g->first[e.node + 1]; i++) {
+            uint32_t v = g->target[i];
+            uint64_t d = e.dist + g->weight[i];
+            if (d < dist[v]) {
+                dist[v] = d;
+                Entry next = { d, v };
+                hp__insert_internal(heap, &next);
+                if (hp_get_size(heap) > max_size)
+                    max_size = hp_get_size(heap);
+            }
+        }
+    }
+
+    hp_destroy(heap);
+    return max_size;
+}
+
+// 3. Both Dijkstra variants find the same distances on a small graph
+static void test_dijkstra(void) {
+    Graph g = make_graph(2000, 6);
+    uint64_t *a = malloc(g.nodes * sizeof(uint64_t));
+    uint64_t *b = malloc(g.nodes * sizeof(uint64_t));
+
+    dijkstra_indexed(&g, a);
+    dijkstra_lazy(&g, b);
+    EXPECT_TRUE(memcmp(a, b, g.nodes * sizeof(uint64_t)) == 0, "Dijkstra distances agree");
+    EXPECT_EQ_INT(a[0] == 0, 1, "source distance");
+
+    free(a);
+    free(b);
+    free_graph(&g);
+}
+
+// 4. Decrease-key against lazy duplicates on a large graph
+static void test_timed_dijkstra(void) {
+    const uint32_t NUM_NODES = 1000000;
+    Graph g = make_graph(NUM_NODES, 8);
+    uint64_t *a = malloc(NUM_NODES * sizeof(uint64_t));
+    uint64_t *b = malloc(NUM_NODES * sizeof(uint64_t));
+    if (!g.first || !g.target || !g.weight || !a || !b) {
+        fprintf(stderr, "[ERROR] Could not allocate memory for Dijkstra benchmark.\n");
+        free(a);
+        free(b);
+        free_graph(&g);
+        return;
+    }
+
+    struct timespec start, end;
+    clock_gettime(1, &start);
+    dijkstra_indexed(&g, a);
+    clock_gettime(1, &end);
+    double indexed_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    int lazy_max = dijkstra_lazy(&g, b);
+    clock_gettime(1, &end);
+    double lazy_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    EXPECT_TRUE(memcmp(a, b, NUM_NODES * sizeof(uint64_t)) == 0, "benchmark distances agree");
+    printf("Dijkstra on %u nodes: IndexedHeap %.3f s (at most %u entries); "
+           "Heap with duplicates %.3f s (peak %d entries)\n",
+           NUM_NODES, indexed_sec, NUM_NODES, lazy_sec, lazy_max);
+
+    free(a);
+    free(b);
+    free_graph(&g);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_against_model();
+    test_dijkstra();
+    test_timed_dijkstra();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
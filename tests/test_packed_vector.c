@@ -0,0 +1,349 @@
+// test_packed_vector.c
+// Tests for the compressed integer vectors (ds_packed_vector.h): round trips at
+// every bit width, bulk decode at each SIMD level, delta blocks against a sorted
+// Vector, memory footprint, and scan throughput against a plain uint64_t Vector.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_packed_vector.h"
+#include "../include/ds_vector_simd.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+static uint64_t rand64(void) {
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+static uint64_t mask_bits(unsigned bits) {
+    return bits == 64 ? UINT64_MAX : ((uint64_t)1 << bits) - 1;
+}
+
+// 1. Invalid input
+static void test_invalid_input(void) {
+    uint64_t value;
+    size_t index;
+
+    EXPECT_TRUE(pv_create(0, 10) == NULL, "zero bits");
+    EXPECT_TRUE(pv_create(65, 10) == NULL, "more than 64 bits");
+
+    PackedVector *pv = pv_create(4, 0);
+    EXPECT_EQ_INT(pv_push_back(pv, 16), -1, "value wider than 4 bits");
+    EXPECT_EQ_INT(pv_push_back(pv, 15), 0, "widest 4-bit value");
+    EXPECT_EQ_INT(pv_get(pv, 1, &value), -2, "get out of bounds");
+    EXPECT_EQ_INT(pv_set(pv, 0, 99), -1, "set value too wide");
+    EXPECT_EQ_INT(pv_decode(pv, 0, 2, &value), -2, "decode past the end");
+    EXPECT_EQ_INT(pv_get(NULL, 0, &value), -1, "get on NULL");
+    pv_destroy(pv);
+    pv_destroy(NULL);
+
+    Vector *ints = vec_create(4, sizeof(int32_t));
+    EXPECT_TRUE(pv_from_vector(ints, V_KEY_I32) == NULL, "signed source rejected");
+    EXPECT_TRUE(pv_from_vector(ints, V_KEY_U64) == NULL, "type not matching data_size");
+    vec_destroy(ints);
+
+    DeltaVector *dv = dv_create();
+    EXPECT_EQ_INT(dv_push_back(dv, 10), 0, "first value");
+    EXPECT_EQ_INT(dv_push_back(dv, 9), -1, "decreasing value rejected");
+    EXPECT_EQ_INT(dv_get(dv, 1, &value), -2, "dv get out of bounds");
+    EXPECT_EQ_INT(dv_lower_bound(dv, 5, NULL), -1, "lower_bound without index");
+    EXPECT_EQ_INT(dv_lower_bound(dv, 11, &index), 0, "lower_bound past the end");
+    EXPECT_EQ_SIZE(index, 1, "lower_bound past the end is size");
+    dv_destroy(dv);
+    dv_destroy(NULL);
+
+    Vector *unsorted = vec_create(4, sizeof(uint32_t));
+    uint32_t a = 5, b = 3;
+    v_push_back(unsorted, &a);
+    v_push_back(unsorted, &b);
+    EXPECT_TRUE(dv_from_vector(unsorted, V_KEY_U32) == NULL, "unsorted source rejected");
+    vec_destroy(unsorted);
+}
+
+// 2. Every width from 1 to 64 bits: push, get, set and decode at each SIMD level
+static void test_all_widths(void) {
+    const size_t n = 1000;
+    uint64_t *expect = malloc(n * sizeof(uint64_t));
+    uint64_t *out = malloc(n * sizeof(uint64_t));
+    VecSimdLevel levels[] = { V_SIMD_SCALAR, V_SIMD_AVX2 };
+
+    for (unsigned bits = 1; bits <= 64; bits++) {
+        PackedVector *pv = pv_create(bits, 0);
+        int ok = 1;
+
+        for (size_t i = 0; i < n; i++) {
+            expect[i] = rand64() & mask_bits(bits);
+            ok &= pv_push_back(pv, expect[i]) == 0;
+        }
+        for (size_t i = 0; i < n; i += 3) {
+            expect[i] = rand64() & mask_bits(bits);
+            ok &= pv_set(pv, i, expect[i]) == 0;
+        }
+        for (size_t i = 0; i < n; i++) {
+            uint64_t v;
+            ok &= pv_get(pv, i, &v) == 0 && v == expect[i];
+        }
+
+        for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+            VecSimdLevel previous = v_simd_set_level(levels[l]);
+            for (size_t start = 0; start < 9; start++) {
+                size_t count = n - start - (start * 7) % 5;
+                ok &= pv_decode(pv, start, count, out) == 0;
+                ok &= memcmp(out, expect + start, count * sizeof(uint64_t)) == 0;
+            }
+            v_simd_set_level(previous);
+        }
+
+        EXPECT_TRUE(ok, "round trip at every width");
+        EXPECT_EQ_SIZE(pv_size(pv), n, "size");
+        EXPECT_EQ_INT(pv_bits(pv), bits, "bits");
+        pv_destroy(pv);
+    }
+
+    free(expect);
+    free(out);
+}
+
+// 3. Building from a Vector picks the narrowest width
+static void test_from_vector(void) {
+    const size_t n = 100000;
+    Vector *v32 = vec_create(n, sizeof(uint32_t));
+    Vector *v64 = vec_create(n, sizeof(uint64_t));
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t a = (uint32_t)(rand() % 1000);
+        uint64_t b = rand64() & mask_bits(40);
+        v_push_back(v32, &a);
+        v_push_back(v64, &b);
+    }
+
+    PackedVector *p32 = pv_from_vector(v32, V_KEY_U32);
+    PackedVector *p64 = pv_from_vector(v64, V_KEY_U64);
+    EXPECT_EQ_INT(pv_bits(p32), 10, "values below 1000 take 10 bits");
+    EXPECT_TRUE(pv_bits(p64) <= 40, "40-bit values take at most 40 bits");
+
+    uint32_t *d32 = v_data(v32, NULL);
+    uint64_t *d64 = v_data(v64, NULL);
+    int ok = 1;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t a, b;
+        ok &= pv_get(p32, i, &a) == 0 && a == d32[i];
+        ok &= pv_get(p64, i, &b) == 0 && b == d64[i];
+    }
+    EXPECT_TRUE(ok, "from_vector contents");
+
+    size_t plain = n * sizeof(uint64_t);
+    EXPECT_TRUE(pv_memory(p32) * 6 < plain, "10-bit values use over 6x less than uint64_t");
+
+    // An all-zero Vector still gets one bit per value
+    Vector *zeros = vec_create(10, sizeof(uint64_t));
+    uint64_t z = 0;
+    for (int i = 0; i < 10; i++)
+        v_push_back(zeros, &z);
+    PackedVector *pz = pv_from_vector(zeros, V_KEY_U64);
+    EXPECT_EQ_INT(pv_bits(pz), 1, "zeros take one bit");
+    EXPECT_EQ_SIZE(pv_size(pz), 10, "zeros size");
+
+    pv_destroy(p32);
+    pv_destroy(p64);
+    pv_destroy(pz);
+    vec_destroy(v32);
+    vec_destroy(v64);
+    vec_destroy(zeros);
+}
+
+// 4. Sorted sequences: get, decode and lower_bound against the Vector
+static void test_delta(void) {
+    static const size_t sizes[] = { 1, 127, 128, 129, 1000, 50000 };
+    VecSimdLevel levels[] = { V_SIMD_SCALAR, V_SIMD_AVX2 };
+
+    for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); t++) {
+        size_t n = sizes[t];
+        Vector *v = vec_create(n, sizeof(uint64_t));
+        uint64_t value = rand64() >> 8;
+
+        for (size_t i = 0; i < n; i++) {
+            // Mostly small gaps, some runs of equal values and a few large jumps
+            int r = rand() % 100;
+            value += r < 20 ? 0 : r < 98 ? (uint64_t)(rand() % 50) : (uint64_t)rand() << 8;
+            v_push_back(v, &value);
+        }
+
+        DeltaVector *dv = dv_from_vector(v, V_KEY_U64);
+        uint64_t *data = v_data(v, NULL);
+        uint64_t *out = malloc(n * sizeof(uint64_t));
+        int ok = dv != NULL && dv_size(dv) == n;
+
+        for (size_t l = 0; ok && l < sizeof(levels) / sizeof(levels[0]); l++) {
+            VecSimdLevel previous = v_simd_set_level(levels[l]);
+
+            for (size_t i = 0; i < n; i += 1 + n / 500) {
+                uint64_t got;
+                ok &= dv_get(dv, i, &got) == 0 && got == data[i];
+            }
+
+            ok &= dv_decode(dv, 0, n, out) == 0 && memcmp(out, data, n * sizeof(uint64_t)) == 0;
+            size_t start = n / 3, count = n - start - n / 5;
+            ok &= dv_decode(dv, start, count, out) == 0;
+            ok &= memcmp(out, data + start, count * sizeof(uint64_t)) == 0;
+
+            v_simd_set_level(previous);
+        }
+        EXPECT_TRUE(ok, "get and decode match the Vector");
+
+        // lower_bound at stored values, between them and past both ends
+        for (int q = 0; ok && q < 300; q++) {
+            uint64_t key = q == 0 ? 0 : q == 1 ? UINT64_MAX : data[rand() % n] + (uint64_t)(rand() % 3) - 1;
+            size_t expect = 0, got;
+            while (expect < n && data[expect] < key)
+                expect++;
+            ok &= dv_lower_bound(dv, key, &got) == 0 && got == expect;
+        }
+        EXPECT_TRUE(ok, "lower_bound matches a linear scan");
+
+        free(out);
+        dv_destroy(dv);
+        vec_destroy(v);
+    }
+}
+
+// 5. Dense sorted ids compress well below their uint64_t size
+static void test_delta_memory(void) {
+    const size_t n = 1000000;
+    Vector *v = vec_create(n, sizeof(uint64_t));
+    uint64_t id = 1000000000000ULL;
+    for (size_t i = 0; i < n; i++) {
+        id += 1 + (uint64_t)(rand() % 16);
+        v_push_back(v, &id);
+    }
+
+    DeltaVector *dv = dv_from_vector(v, V_KEY_U64);
+    size_t plain = n * sizeof(uint64_t);
+    EXPECT_TRUE(dv != NULL && dv_memory(dv) * 6 < plain, "small gaps use over 6x less than uint64_t");
+
+    dv_destroy(dv);
+    vec_destroy(v);
+}
+
+// 6. Summing blockwise decodes against summing the plain Vector
+static void test_timed_scan(void) {
+    const size_t NUM_VALUES = 10000000;
+    const size_t CHUNK = 1024;
+    const int PASSES = 5;
+    Vector *v = vec_create(NUM_VALUES, sizeof(uint64_t));
+    uint64_t *buf = malloc(CHUNK * sizeof(uint64_t));
+    if (!v || !buf) {
+        fprintf(stderr, "[ERROR] Could not allocate memory for scan benchmark.\n");
+        vec_destroy(v);
+        free(buf);
+        return;
+    }
+
+    uint64_t value = 0;
+    for (size_t i = 0; i < NUM_VALUES; i++) {
+        value += (uint64_t)(rand() % 64);
+        v_push_back(v, &value);
+    }
+
+    PackedVector *pv = pv_from_vector(v, V_KEY_U64);
+    DeltaVector *dv = dv_from_vector(v, V_KEY_U64);
+    struct timespec start, end;
+    uint64_t plain_sum = 0, packed_sum = 0, delta_sum = 0;
+
+    clock_gettime(1, &start);
+    for (int p = 0; p < PASSES; p++) {
+        uint64_t *data = v_data(v, NULL);
+        for (size_t i = 0; i < NUM_VALUES; i++)
+            plain_sum += data[i];
+    }
+    clock_gettime(1, &end);
+    double plain_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    for (int p = 0; p < PASSES; p++) {
+        for (size_t i = 0; i < NUM_VALUES; i += CHUNK) {
+            size_t n = NUM_VALUES - i < CHUNK ? NUM_VALUES - i : CHUNK;
+            pv_decode(pv, i, n, buf);
+            for (size_t j = 0; j < n; j++)
+                packed_sum += buf[j];
+        }
+    }
+    clock_gettime(1, &end);
+    double packed_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    for (int p = 0; p < PASSES; p++) {
+        for (size_t i = 0; i < NUM_VALUES; i += CHUNK) {
+            size_t n = NUM_VALUES - i < CHUNK ? NUM_VALUES - i : CHUNK;
+            dv_decode(dv, i, n, buf);
+            for (size_t j = 0; j < n; j++)
+                delta_sum += buf[j];
+        }
+    }
+    clock_gettime(1, &end);
+    double delta_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    EXPECT_TRUE(packed_sum == plain_sum && delta_sum == plain_sum, "scan sums agree");
+
+    printf("Scan of %zu values x%d: Vector %.3f s (%zu MB); PackedVector %u bits %.3f s (%zu MB); "
+           "DeltaVector %.3f s (%zu MB)\n",
+           NUM_VALUES, PASSES, plain_sec, NUM_VALUES * sizeof(uint64_t) >> 20,
+           pv_bits(pv), packed_sec, pv_memory(pv) >> 20, delta_sec, dv_memory(dv) >> 20);
+
+    pv_destroy(pv);
+    dv_destroy(dv);
+    vec_destroy(v);
+    free(buf);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_all_widths();
+    test_from_vector();
+    test_delta();
+    test_delta_memory();
+    test_timed_scan();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
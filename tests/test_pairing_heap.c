@@ -0,0 +1,280 @@
+// test_pairing_heap.c
+// Tests for the pairing heap (ds_pairing_heap.h): pops in order, decrease-key
+// and removal through node handles, handles that survive a meld, checks
+// against a brute-force model, and meld cost against reinserting into Heap.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_pairing_heap.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+typedef struct {
+    int key;
+    int id;
+} Item;
+
+static int item_less(const void *a, const void *b) {
+    return ((const Item *)a)->key < ((const Item *)b)->key;
+}
+
+static int int_less(const void *a, const void *b) {
+    return *(const int *)a < *(const int *)b;
+}
+
+static int int_min_compare(const void *arr, int child_idx, int parent_idx) {
+    const int *a = (const int *)arr;
+    return a[child_idx] < a[parent_idx];
+}
+
+// 1. Invalid input and empty heap
+static void test_invalid_input(void) {
+    int v = 3;
+
+    EXPECT_TRUE(ph_create(0, int_less) == NULL, "zero data_size");
+    EXPECT_TRUE(ph_create(sizeof(int), NULL) == NULL, "no comparator");
+
+    PairingHeap *heap = ph_create(sizeof(int), int_less);
+    PairingHeap *other = ph_create(sizeof(Item), item_less);
+    EXPECT_EQ_INT(ph_pop(heap, &v), 1, "pop empty");
+    EXPECT_EQ_INT(ph_peek(heap, &v), 1, "peek empty");
+    EXPECT_TRUE(ph_push(heap, NULL) == NULL, "push NULL");
+    EXPECT_EQ_INT(ph_meld(heap, other), -1, "meld heaps of different elements");
+    EXPECT_EQ_INT(ph_meld(heap, heap), -1, "meld with itself");
+
+    PairingNode *node = ph_push(heap, &v);
+    int higher = 5;
+    EXPECT_EQ_INT(ph_decrease_key(heap, node, &higher), -1, "decrease_key cannot move down");
+    EXPECT_EQ_INT(*(int *)ph_data(node), 3, "rejected update leaves the value");
+
+    ph_destroy(heap);
+    ph_destroy(other);
+    ph_destroy(NULL);
+}
+
+// 2. Pushes, pops and meld give sorted output
+static void test_sorted_output(void) {
+    PairingHeap *a = ph_create(sizeof(int), int_less);
+    PairingHeap *b = ph_create(sizeof(int), int_less);
+
+    for (int i = 0; i < 50000; i++) {
+        int v = rand() % 100000;
+        ph_push(i % 2 ? a : b, &v);
+    }
+    // Pop some first so both heaps have free nodes to hand over
+    for (int i = 0; i < 1000; i++) {
+        ph_pop(a, NULL);
+        ph_pop(b, NULL);
+    }
+
+    EXPECT_EQ_INT(ph_meld(a, b), 0, "meld");
+    EXPECT_EQ_SIZE(ph_size(a), 48000, "melded size");
+    EXPECT_EQ_SIZE(ph_size(b), 0, "source is empty");
+
+    // The emptied source is still usable
+    int v = 7;
+    EXPECT_TRUE(ph_push(b, &v) != NULL, "push into emptied source");
+    EXPECT_EQ_INT(ph_peek(b, &v), 0, "peek emptied source");
+    EXPECT_EQ_INT(v, 7, "emptied source value");
+
+    // Nodes recycled from b's free list and slabs after the meld
+    for (int i = 0; i < 3000; i++) {
+        v = rand() % 100000;
+        ph_push(a, &v);
+    }
+
+    int prev = -1, ok = 1;
+    size_t count = 0;
+    while (ph_pop(a, &v) == 0) {
+        ok &= v >= prev;
+        prev = v;
+        count++;
+    }
+    EXPECT_TRUE(ok, "pops are in order");
+    EXPECT_EQ_SIZE(count, 51000, "every element popped");
+
+    ph_destroy(a);
+    ph_destroy(b);
+}
+
+// 3. Random operations against a brute-force model, handles used across melds
+static void test_against_model(void) {
+    enum { MAX_ITEMS = 20000 };
+    static int key[MAX_ITEMS];
+    static char live[MAX_ITEMS];
+    static PairingNode *node[MAX_ITEMS];
+    memset(live, 0, sizeof(live));
+
+    PairingHeap *heap = ph_create(sizeof(Item), item_less);
+    PairingHeap *side = ph_create(sizeof(Item), item_less);
+    int next_id = 0, ok = 1;
+    size_t live_count = 0;
+
+    for (int step = 0; step < 100000 && ok; step++) {
+        int op = rand() % 20;
+
+        if ((op < 8 && next_id < MAX_ITEMS) || (live_count == 0 && next_id < MAX_ITEMS)) {
+            // Push, to the side heap now and then, which is melded in later
+            Item it = { rand() % 1000000, next_id };
+            node[next_id] = ph_push(op == 0 ? side : heap, &it);
+            key[next_id] = it.key;
+            live[next_id] = 1;
+            next_id++;
+            live_count++;
+        } else if (op < 10) {
+            ok &= ph_meld(heap, side) == 0;
+        } else if (live_count > 0) {
+            int id = rand() % next_id;
+            while (!live[id])
+                id = (id + 1) % next_id;
+
+            // Handles in the side heap can only be used there; meld first
+            ph_meld(heap, side);
+
+            if (op < 15) {
+                Item it = { key[id] - rand() % 1000, id };
+                ok &= ph_decrease_key(heap, node[id], &it) == 0;
+                key[id] = it.key;
+            } else if (op < 17) {
+                Item got;
+                ok &= ph_remove(heap, node[id], &got) == 0 && got.id == id && got.key == key[id];
+                live[id] = 0;
+                live_count--;
+            } else {
+                int min = 1 << 30;
+                for (int i = 0; i < next_id; i++)
+                    if (live[i] && key[i] < min)
+                        min = key[i];
+
+                Item got;
+                ok &= ph_pop(heap, &got) == 0 && got.key == min && live[got.id] && key[got.id] == min;
+                live[got.id] = 0;
+                live_count--;
+            }
+        }
+
+        ok &= ph_size(heap) + ph_size(side) == live_count;
+    }
+
+    EXPECT_TRUE(ok, "operations match the model");
+
+    ph_meld(heap, side);
+    Item got;
+    int prev = -(1 << 30);
+    while (ok && ph_pop(heap, &got) == 0) {
+        ok &= got.key >= prev && live[got.id];
+        prev = got.key;
+        live[got.id] = 0;
+    }
+    EXPECT_TRUE(ok, "final drain is ordered");
+
+    ph_destroy(heap);
+    ph_destroy(side);
+}
+
+// 4. Merging per-worker queues: meld against reinserting into a Heap
+static void test_timed_meld(void) {
+    const int NUM_WORKERS = 8;
+    const int PER_WORKER = 500000;
+    PairingHeap *global = ph_create(sizeof(int), int_less);
+    PairingHeap **workers = malloc(NUM_WORKERS * sizeof(PairingHeap *));
+    Heap *heap_global = hp_init(sizeof(int), 1024, int_min_compare);
+    Heap **heap_workers = malloc(NUM_WORKERS * sizeof(Heap *));
+
+    for (int w = 0; w < NUM_WORKERS; w++) {
+        workers[w] = ph_create(sizeof(int), int_less);
+        heap_workers[w] = hp_init(sizeof(int), 1024, int_min_compare);
+        for (int i = 0; i < PER_WORKER; i++) {
+            int v = rand();
+            ph_push(workers[w], &v);
+            hp__insert_internal(heap_workers[w], &v);
+        }
+    }
+
+    struct timespec start, end;
+    clock_gettime(1, &start);
+    for (int w = 0; w < NUM_WORKERS; w++)
+        ph_meld(global, workers[w]);
+    clock_gettime(1, &end);
+    double meld_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    for (int w = 0; w < NUM_WORKERS; w++) {
+        int v;
+        while (hp_pop(heap_workers[w], &v) == 0)
+            hp__insert_internal(heap_global, &v);
+    }
+    clock_gettime(1, &end);
+    double heap_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    EXPECT_EQ_SIZE(ph_size(global), (size_t)NUM_WORKERS * PER_WORKER, "melded size");
+    EXPECT_EQ_INT(hp_get_size(heap_global), NUM_WORKERS * PER_WORKER, "reinserted size");
+
+    int a, b;
+    ph_peek(global, &a);
+    hp_peek(heap_global, &b);
+    EXPECT_EQ_INT(a, b, "same minimum");
+
+    printf("Merging %d queues of %d items: ph_meld %.6f s; Heap pop+reinsert %.3f s\n",
+           NUM_WORKERS, PER_WORKER, meld_sec, heap_sec);
+
+    for (int w = 0; w < NUM_WORKERS; w++) {
+        ph_destroy(workers[w]);
+        hp_destroy(heap_workers[w]);
+    }
+    free(workers);
+    free(heap_workers);
+    ph_destroy(global);
+    hp_destroy(heap_global);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_sorted_output();
+    test_against_model();
+    test_timed_meld();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
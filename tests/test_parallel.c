@@ -0,0 +1,308 @@
+// test_parallel.c
+// Tests for the thread pool and parallel algorithms (ds_parallel.h).
+// Every operation is checked against a plain loop, with a pool, with a
+// NULL pool and with grains that produce one, a few and many chunks.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_parallel.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+// Callbacks
+static void add_ctx(void *elem, void *ctx) {
+    *(int64_t *)elem += *(int64_t *)ctx;
+}
+
+static void square_to_double(const void *in, void *out, void *ctx) {
+    (void)ctx;
+    int64_t x = *(const int64_t *)in;
+    *(double *)out = (double)x * (double)x;
+}
+
+static int is_multiple(const void *elem, void *ctx) {
+    return *(const int64_t *)elem % *(int64_t *)ctx == 0;
+}
+
+static void sum_i64(void *acc, const void *elem, void *ctx) {
+    (void)ctx;
+    *(int64_t *)acc += *(const int64_t *)elem;
+}
+
+// Non-commutative but associative: composition of affine maps x -> a*x + b (mod 2^64)
+typedef struct {
+    uint64_t a;
+    uint64_t b;
+} Affine;
+
+static void compose_affine(void *acc, const void *elem, void *ctx) {
+    (void)ctx;
+    Affine *f = acc;
+    const Affine *g = elem;
+    Affine r = { g->a * f->a, g->a * f->b + g->b };
+    *f = r;
+}
+
+static int64_t *make_data(size_t n) {
+    int64_t *data = malloc((n ? n : 1) * sizeof(int64_t));
+    for (size_t i = 0; i < n; i++)
+        data[i] = rand() % 20001 - 10000;
+    return data;
+}
+
+// 1. Pool lifecycle and invalid input
+static void test_pool_and_invalid_input(void) {
+    ThreadPool *pool = tp_create(4);
+    EXPECT_TRUE(pool != NULL, "tp_create(4)");
+    EXPECT_EQ_SIZE(tp_size(pool), 4, "tp_size of 4-thread pool");
+    EXPECT_EQ_SIZE(tp_size(NULL), 1, "tp_size of NULL pool");
+
+    ThreadPool *automatic = tp_create(0);
+    EXPECT_TRUE(automatic != NULL && tp_size(automatic) >= 1, "tp_create(0) uses online CPUs");
+    tp_destroy(automatic);
+    tp_destroy(NULL);
+
+    int64_t x = 0, id = 0;
+    size_t count;
+    EXPECT_EQ_INT(par_for_each(pool, NULL, 1, sizeof(int64_t), 0, add_ctx, &x), -1, "for_each without array");
+    EXPECT_EQ_INT(par_for_each(pool, &x, 1, 0, 0, add_ctx, &x), -1, "for_each with zero data_size");
+    EXPECT_EQ_INT(par_map(pool, &x, 1, sizeof(x), &x, sizeof(x), 0, NULL, NULL), -1, "map without callback");
+    EXPECT_EQ_INT(par_filter(pool, &x, 1, sizeof(x), &x, NULL, 0, is_multiple, &x), -1, "filter without count");
+    EXPECT_EQ_INT(par_reduce(pool, &x, 1, sizeof(x), 0, NULL, sum_i64, NULL, &x), -1, "reduce without identity");
+    EXPECT_EQ_INT(par_scan(pool, &x, &x, 1, sizeof(x), 0, &id, NULL, NULL, 1), -1, "scan without combiner");
+    EXPECT_EQ_INT(par_filter(pool, NULL, 0, sizeof(x), NULL, &count, 0, is_multiple, &x), 0, "filter of empty input");
+    EXPECT_EQ_SIZE(count, 0, "filter of empty input keeps nothing");
+    EXPECT_EQ_INT(v_par_for_each(pool, NULL, 0, add_ctx, &x), -1, "v_par_for_each on NULL vector");
+
+    Vector *a = vec_create(4, sizeof(int64_t));
+    Vector *b = vec_create(4, sizeof(int32_t));
+    EXPECT_EQ_INT(v_par_filter(pool, a, b, 0, is_multiple, &x), -1, "v_par_filter with mismatched data_size");
+    EXPECT_EQ_INT(v_par_map(pool, a, a, 0, square_to_double, NULL), -1, "v_par_map in place");
+    vec_destroy(a);
+    vec_destroy(b);
+
+    tp_destroy(pool);
+}
+
+// 2. for_each, map, filter, reduce and scan against serial loops
+static void check_all_ops(ThreadPool *pool, size_t n, size_t grain) {
+    int64_t *data = make_data(n);
+    int64_t *work = malloc((n ? n : 1) * sizeof(int64_t));
+    double *mapped = malloc((n ? n : 1) * sizeof(double));
+    int ok;
+
+    // for_each
+    int64_t delta = 7;
+    memcpy(work, data, n * sizeof(int64_t));
+    EXPECT_EQ_INT(par_for_each(pool, work, n, sizeof(int64_t), grain, add_ctx, &delta), 0, "for_each return code");
+    ok = 1;
+    for (size_t i = 0; i < n; i++)
+        ok &= work[i] == data[i] + 7;
+    EXPECT_TRUE(ok, "for_each result");
+
+    // map
+    EXPECT_EQ_INT(par_map(pool, data, n, sizeof(int64_t), mapped, sizeof(double), grain, square_to_double, NULL), 0,
+                  "map return code");
+    ok = 1;
+    for (size_t i = 0; i < n; i++)
+        ok &= mapped[i] == (double)data[i] * (double)data[i];
+    EXPECT_TRUE(ok, "map result");
+
+    // filter
+    int64_t divisor = 3;
+    size_t count = 0, expect_count = 0;
+    EXPECT_EQ_INT(par_filter(pool, data, n, sizeof(int64_t), work, &count, grain, is_multiple, &divisor), 0,
+                  "filter return code");
+    ok = 1;
+    for (size_t i = 0; i < n; i++)
+        if (data[i] % 3 == 0)
+            ok &= expect_count < count && work[expect_count++] == data[i];
+    EXPECT_EQ_SIZE(count, expect_count, "filter count");
+    EXPECT_TRUE(ok, "filter keeps survivors in order");
+
+    // reduce
+    int64_t zero = 0, sum = -1, expect_sum = 0;
+    for (size_t i = 0; i < n; i++)
+        expect_sum += data[i];
+    EXPECT_EQ_INT(par_reduce(pool, data, n, sizeof(int64_t), grain, &zero, sum_i64, NULL, &sum), 0, "reduce return code");
+    EXPECT_TRUE(sum == expect_sum, "reduce sum");
+
+    // inclusive and exclusive scan, out of place and in place
+    for (int inclusive = 0; inclusive <= 1; inclusive++) {
+        EXPECT_EQ_INT(par_scan(pool, data, work, n, sizeof(int64_t), grain, &zero, sum_i64, NULL, inclusive), 0,
+                      "scan return code");
+        int64_t running = 0;
+        ok = 1;
+        for (size_t i = 0; i < n; i++) {
+            if (inclusive) running += data[i];
+            ok &= work[i] == running;
+            if (!inclusive) running += data[i];
+        }
+        EXPECT_TRUE(ok, inclusive ? "inclusive scan" : "exclusive scan");
+
+        memcpy(work, data, n * sizeof(int64_t));
+        par_scan(pool, work, work, n, sizeof(int64_t), grain, &zero, sum_i64, NULL, inclusive);
+        running = 0;
+        ok = 1;
+        for (size_t i = 0; i < n; i++) {
+            if (inclusive) running += data[i];
+            ok &= work[i] == running;
+            if (!inclusive) running += data[i];
+        }
+        EXPECT_TRUE(ok, inclusive ? "inclusive scan in place" : "exclusive scan in place");
+    }
+
+    // Non-commutative combiner must see the chunks in order
+    Affine *maps = malloc((n ? n : 1) * sizeof(Affine));
+    Affine identity = { 1, 0 }, folded, expect = { 1, 0 };
+    for (size_t i = 0; i < n; i++) {
+        maps[i].a = (uint64_t)rand() * 2 + 1;
+        maps[i].b = (uint64_t)rand();
+        compose_affine(&expect, &maps[i], NULL);
+    }
+    par_reduce(pool, maps, n, sizeof(Affine), grain, &identity, compose_affine, NULL, &folded);
+    EXPECT_TRUE(folded.a == expect.a && folded.b == expect.b, "reduce keeps order of non-commutative combiner");
+
+    free(maps);
+    free(mapped);
+    free(work);
+    free(data);
+}
+
+static void test_ops_against_serial(void) {
+    ThreadPool *pool = tp_create(4);
+    static const size_t sizes[] = { 0, 1, 2, 17, 1000, 4096, 4097, 100000 };
+    static const size_t grains[] = { 0, 1, 7, 1024 };
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t g = 0; g < sizeof(grains) / sizeof(grains[0]); g++) {
+            check_all_ops(pool, sizes[s], grains[g]);
+            check_all_ops(NULL, sizes[s], grains[g]);
+        }
+    }
+
+    tp_destroy(pool);
+}
+
+// 3. Vector wrappers
+static void test_vector_wrappers(void) {
+    ThreadPool *pool = tp_create(3);
+    const size_t n = 50000;
+    Vector *src = vec_create(16, sizeof(int64_t));
+    Vector *dst = vec_create(1, sizeof(int64_t));
+    Vector *doubles = vec_create(1, sizeof(double));
+
+    for (size_t i = 0; i < n; i++) {
+        int64_t x = (int64_t)i;
+        v_push_back(src, &x);
+    }
+
+    int64_t one = 1;
+    EXPECT_EQ_INT(v_par_for_each(pool, src, 0, add_ctx, &one), 0, "v_par_for_each return code");
+    EXPECT_TRUE(*(int64_t *)v_at(src, n - 1) == (int64_t)n, "v_par_for_each updates elements");
+
+    EXPECT_EQ_INT(v_par_map(pool, src, doubles, 1000, square_to_double, NULL), 0, "v_par_map return code");
+    EXPECT_EQ_SIZE(v_size(doubles), n, "v_par_map sizes destination");
+    EXPECT_TRUE(*(double *)v_at(doubles, 9) == 100.0, "v_par_map result");
+
+    int64_t divisor = 10;
+    EXPECT_EQ_INT(v_par_filter(pool, src, dst, 1000, is_multiple, &divisor), 0, "v_par_filter return code");
+    EXPECT_EQ_SIZE(v_size(dst), n / 10, "v_par_filter keeps multiples of ten");
+    EXPECT_TRUE(*(int64_t *)v_at(dst, 3) == 40, "v_par_filter order");
+
+    int64_t zero = 0, sum = 0;
+    EXPECT_EQ_INT(v_par_reduce(pool, src, 0, &zero, sum_i64, NULL, &sum), 0, "v_par_reduce return code");
+    EXPECT_TRUE(sum == (int64_t)(n * (n + 1) / 2), "v_par_reduce sum");
+
+    EXPECT_EQ_INT(v_par_scan(pool, src, src, 1000, &zero, sum_i64, NULL, 1), 0, "v_par_scan in place");
+    EXPECT_TRUE(*(int64_t *)v_back(src) == sum, "v_par_scan last prefix equals total");
+
+    vec_destroy(doubles);
+    vec_destroy(dst);
+    vec_destroy(src);
+    tp_destroy(pool);
+}
+
+// 4. Scaling of reduce and map with the number of threads
+static void test_timed_scaling(void) {
+    const size_t NUM_ELEMENTS = 8000000;
+    int64_t *data = make_data(NUM_ELEMENTS);
+    double *mapped = malloc(NUM_ELEMENTS * sizeof(double));
+    if (!data || !mapped) {
+        fprintf(stderr, "[ERROR] Could not allocate arrays for parallel benchmark.\n");
+        free(data);
+        free(mapped);
+        return;
+    }
+
+    static const size_t threads[] = { 1, 2, 4, 8 };
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        ThreadPool *pool = tp_create(threads[t]);
+        struct timespec start, end;
+        int64_t zero = 0, sum;
+
+        clock_gettime(1, &start);
+        par_reduce(pool, data, NUM_ELEMENTS, sizeof(int64_t), 0, &zero, sum_i64, NULL, &sum);
+        par_map(pool, data, NUM_ELEMENTS, sizeof(int64_t), mapped, sizeof(double), 0, square_to_double, NULL);
+        clock_gettime(1, &end);
+
+        double elapsed_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        printf("%zu thread(s): reduce+map over %zu int64 in %.3f seconds\n",
+               threads[t], NUM_ELEMENTS, elapsed_sec);
+        tp_destroy(pool);
+    }
+
+    free(mapped);
+    free(data);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_pool_and_invalid_input();
+    test_ops_against_serial();
+    test_vector_wrappers();
+    test_timed_scaling();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,239 @@
+// test_radix_heap.c
+// Tests for the radix heap (ds_radix_heap.h): monotone pop order with values
+// for 32- and 64-bit keys, key range checks, interleaved push and pop against
+// a Heap, and an event-simulation benchmark against Heap.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_radix_heap.h"
+#include "../include/ds_heap.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+typedef struct {
+    uint64_t time;
+    uint32_t id;
+} Event;
+
+static int event_min_compare(const void *arr, int child_idx, int parent_idx) {
+    const Event *a = (const Event *)arr;
+    return a[child_idx].time < a[parent_idx].time;
+}
+
+static uint64_t rand64(void) {
+    return ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+}
+
+// 1. Invalid input and key range
+static void test_invalid_input(void) {
+    uint32_t v = 1;
+    uint64_t key;
+
+    EXPECT_TRUE(rh_create(16, 4) == NULL, "unsupported key width");
+
+    RadixHeap *heap = rh_create(32, sizeof(uint32_t));
+    EXPECT_EQ_INT(rh_pop(heap, &key, &v), 1, "pop empty");
+    EXPECT_EQ_INT(rh_peek(heap, &key, &v), 1, "peek empty");
+    EXPECT_EQ_INT(rh_push(heap, 5, NULL), -1, "push without value");
+    EXPECT_EQ_INT(rh_push(heap, (uint64_t)UINT32_MAX + 1, &v), -1, "key wider than 32 bits");
+    EXPECT_EQ_INT(rh_push(heap, UINT32_MAX, &v), 0, "widest 32-bit key");
+    EXPECT_EQ_INT(rh_push(heap, 100, &v), 0, "push 100");
+    EXPECT_EQ_INT(rh_pop(heap, &key, NULL), 0, "pop");
+    EXPECT_TRUE(key == 100 && rh_last_key(heap) == 100, "last key follows pops");
+    EXPECT_EQ_INT(rh_push(heap, 99, &v), -1, "key below the last popped key");
+    EXPECT_EQ_INT(rh_push(heap, 100, &v), 0, "key equal to the last popped key");
+
+    EXPECT_EQ_INT(rh_clear(heap), 0, "clear");
+    EXPECT_EQ_SIZE(rh_size(heap), 0, "empty after clear");
+    EXPECT_EQ_INT(rh_push(heap, 0, &v), 0, "clear resets the last key");
+    rh_destroy(heap);
+    rh_destroy(NULL);
+
+    // Keys only
+    RadixHeap *keys = rh_create(64, 0);
+    EXPECT_EQ_INT(rh_push(keys, UINT64_MAX, NULL), 0, "widest 64-bit key");
+    EXPECT_EQ_INT(rh_push(keys, 3, NULL), 0, "push key without value");
+    EXPECT_EQ_INT(rh_pop(keys, &key, NULL), 0, "pop key");
+    EXPECT_TRUE(key == 3, "smallest key first");
+    EXPECT_EQ_INT(rh_pop(keys, &key, NULL), 0, "pop widest key");
+    EXPECT_TRUE(key == UINT64_MAX, "widest key last");
+    rh_destroy(keys);
+}
+
+// 2. Interleaved monotone pushes and pops match a Heap, values travel with keys
+static void test_against_heap(void) {
+    unsigned widths[] = { 32, 64 };
+
+    for (int w = 0; w < 2; w++) {
+        RadixHeap *heap = rh_create(widths[w], sizeof(uint32_t));
+        Heap *ref = hp_init(sizeof(Event), 64, event_min_compare);
+        uint64_t span = widths[w] == 32 ? 1u << 20 : (uint64_t)1 << 50;
+        uint64_t now = 0;
+        int ok = 1;
+
+        for (uint32_t i = 0; i < 200000 && ok; i++) {
+            if (rand() % 3 != 0 || rh_size(heap) == 0) {
+                // Bursts of equal keys and keys far in the future
+                Event e = { now + (rand() % 4 == 0 ? 0 : rand64() % span), i };
+                ok &= rh_push(heap, e.time, &e.id) == 0;
+                hp__insert_internal(ref, &e);
+            } else {
+                uint64_t key;
+                uint32_t id;
+                Event e;
+                ok &= rh_pop(heap, &key, &id) == 0 && hp_pop(ref, &e) == 0;
+                ok &= key == e.time && key >= now;
+                now = key;
+                (void)id;
+            }
+        }
+        EXPECT_TRUE(ok, "pop order matches Heap");
+
+        // Values come back with their own keys
+        uint64_t key;
+        uint32_t id;
+        char *seen = calloc(200000, 1);
+        size_t left = rh_size(heap);
+        while (ok && rh_pop(heap, &key, &id) == 0) {
+            ok &= id < 200000 && !seen[id];
+            seen[id] = 1;
+            Event e;
+            ok &= hp_pop(ref, &e) == 0 && e.time == key;
+            left--;
+        }
+        EXPECT_TRUE(ok && left == 0, "drain matches Heap with unique values");
+
+        free(seen);
+        rh_destroy(heap);
+        hp_destroy(ref);
+    }
+}
+
+// 3. Values are returned with the right key when keys are unique
+static void test_values(void) {
+    RadixHeap *heap = rh_create(64, sizeof(uint64_t));
+    for (uint64_t i = 0; i < 10000; i++) {
+        uint64_t key = (i * 7919) % 10000 * 1000;
+        uint64_t value = key + 1;
+        rh_push(heap, key, &value);
+    }
+
+    uint64_t key, value, expected = 0;
+    int ok = 1;
+    while (rh_pop(heap, &key, &value) == 0) {
+        ok &= key == expected && value == key + 1;
+        expected += 1000;
+    }
+    EXPECT_TRUE(ok, "keys in order with matching values");
+    EXPECT_TRUE(expected == 10000 * 1000, "every key popped");
+    rh_destroy(heap);
+}
+
+// 4. Discrete event simulation: pop the next event, schedule a later one
+static void test_timed_simulation(void) {
+    const uint32_t NUM_PENDING = 1000000;
+    const uint32_t NUM_STEPS = 5000000;
+    RadixHeap *heap = rh_create(64, sizeof(uint32_t));
+    Heap *ref = hp_init(sizeof(Event), NUM_PENDING, event_min_compare);
+    uint32_t *delay = malloc(NUM_STEPS * sizeof(uint32_t));
+    if (!heap || !ref || !delay) {
+        fprintf(stderr, "[ERROR] Could not allocate memory for simulation benchmark.\n");
+        rh_destroy(heap);
+        hp_destroy(ref);
+        free(delay);
+        return;
+    }
+
+    for (uint32_t i = 0; i < NUM_STEPS; i++)
+        delay[i] = 1 + (uint32_t)(rand() % 100000);
+
+    struct timespec start, end;
+    uint64_t radix_sum = 0, heap_sum = 0;
+
+    clock_gettime(1, &start);
+    for (uint32_t i = 0; i < NUM_PENDING; i++)
+        rh_push(heap, delay[i], &i);
+    for (uint32_t i = 0; i < NUM_STEPS; i++) {
+        uint64_t now;
+        uint32_t id;
+        rh_pop(heap, &now, &id);
+        radix_sum += now;
+        rh_push(heap, now + delay[i], &id);
+    }
+    clock_gettime(1, &end);
+    double radix_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    for (uint32_t i = 0; i < NUM_PENDING; i++) {
+        Event e = { delay[i], i };
+        hp__insert_internal(ref, &e);
+    }
+    for (uint32_t i = 0; i < NUM_STEPS; i++) {
+        Event e;
+        hp_pop(ref, &e);
+        heap_sum += e.time;
+        e.time += delay[i];
+        hp__insert_internal(ref, &e);
+    }
+    clock_gettime(1, &end);
+    double heap_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    EXPECT_TRUE(radix_sum == heap_sum, "both queues process events in the same order");
+    printf("Event simulation, %u pending, %u steps: RadixHeap %.3f s; Heap %.3f s\n",
+           NUM_PENDING, NUM_STEPS, radix_sec, heap_sec);
+
+    rh_destroy(heap);
+    hp_destroy(ref);
+    free(delay);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_against_heap();
+    test_values();
+    test_timed_simulation();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,196 @@
+// test_seg_vector.c
+// Tests for the segmented vector (ds_seg_vector.h): Vector-style access,
+// address stability across growth, segment iteration and push_back latency.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_seg_vector.h"
+#include "../include/ds_vector.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+// 1. Invalid input and empty vector
+static void test_invalid_input(void) {
+    SegVector *sv = sv_create(3, sizeof(int));
+    int x = 0;
+
+    EXPECT_TRUE(sv_create(4, 0) == NULL, "sv_create with zero data_size");
+    EXPECT_EQ_INT(sv_push_back(NULL, &x), -1, "push_back on NULL");
+    EXPECT_EQ_INT(sv_push_back(sv, NULL), -1, "push_back without data");
+    EXPECT_EQ_INT(sv_pop_back(sv), 1, "pop_back on empty");
+    EXPECT_EQ_INT(sv_top(sv, &x), 1, "top on empty");
+    EXPECT_EQ_INT(sv_get(sv, &x, 0), -2, "get out of bounds");
+    EXPECT_EQ_INT(sv_set(sv, &x, 0), -2, "set out of bounds");
+    EXPECT_TRUE(sv_at(sv, 0) == NULL, "sv_at out of bounds");
+    EXPECT_TRUE(sv_segment(sv, 0, NULL) == NULL, "segment of empty vector");
+    EXPECT_EQ_INT(sv_empty(sv), 1, "empty vector");
+    EXPECT_EQ_INT(sv_empty(NULL), 1, "NULL vector is empty, as with v_empty");
+    EXPECT_EQ_SIZE(sv_capacity(sv), 0, "no segments before first push");
+
+    sv_destroy(sv);
+}
+
+// 2. push/get/set/pop across many segment boundaries
+static void test_basic_ops(void) {
+    static const size_t firsts[] = { 0, 1, 3, 4, 64 };
+
+    for (size_t f = 0; f < sizeof(firsts) / sizeof(firsts[0]); f++) {
+        SegVector *sv = sv_create(firsts[f], sizeof(int64_t));
+        const size_t n = 5000;
+        int ok = 1;
+
+        for (size_t i = 0; i < n; i++) {
+            int64_t x = (int64_t)i * 3;
+            ok &= sv_push_back(sv, &x) == 0;
+        }
+        EXPECT_TRUE(ok, "push_back");
+        EXPECT_EQ_SIZE(sv_size(sv), n, "size after pushes");
+        EXPECT_TRUE(sv_capacity(sv) >= n && sv_capacity(sv) < 2 * n + 64, "capacity grows geometrically");
+
+        for (size_t i = 0; i < n; i++) {
+            int64_t x;
+            ok &= sv_get(sv, &x, i) == 0 && x == (int64_t)i * 3;
+            ok &= *(int64_t *)sv_at(sv, i) == (int64_t)i * 3;
+        }
+        EXPECT_TRUE(ok, "get and sv_at after pushes");
+
+        int64_t y = -1;
+        EXPECT_EQ_INT(sv_set(sv, &y, n / 2), 0, "set");
+        EXPECT_TRUE(*(int64_t *)sv_at(sv, n / 2) == -1, "value after set");
+
+        int64_t *slot = sv_emplace_back(sv);
+        *slot = 77;
+        EXPECT_EQ_INT(sv_top(sv, &y), 0, "top");
+        EXPECT_TRUE(y == 77, "top after emplace_back");
+        EXPECT_EQ_INT(sv_pop_back(sv), 0, "pop_back");
+        EXPECT_EQ_SIZE(sv_size(sv), n, "size after pop_back");
+
+        // Walking segments visits every element once, in order
+        size_t seen = 0, count;
+        int64_t *seg;
+        for (size_t s = 0; (seg = sv_segment(sv, s, &count)) != NULL; s++)
+            for (size_t i = 0; i < count; i++, seen++)
+                ok &= seen == n / 2 ? seg[i] == -1 : seg[i] == (int64_t)seen * 3;
+        EXPECT_EQ_SIZE(seen, n, "segment walk covers all elements");
+        EXPECT_TRUE(ok, "segment walk values");
+
+        sv_destroy(sv);
+    }
+}
+
+// 3. Element addresses never change while the vector grows or shrinks its spare segments
+static void test_stable_addresses(void) {
+    SegVector *sv = sv_create(2, sizeof(int));
+    int *ptrs[100];
+
+    for (int i = 0; i < 100; i++) {
+        sv_push_back(sv, &i);
+        ptrs[i] = sv_at(sv, i);
+    }
+    for (int i = 100; i < 200000; i++)
+        sv_push_back(sv, &i);
+
+    int ok = 1;
+    for (int i = 0; i < 100; i++)
+        ok &= ptrs[i] == sv_at(sv, i) && *ptrs[i] == i;
+    EXPECT_TRUE(ok, "pointers survive growth");
+
+    for (int i = 0; i < 199000; i++)
+        sv_pop_back(sv);
+    size_t before = sv_capacity(sv);
+    EXPECT_EQ_INT(sv_shrink_to_fit(sv), 0, "shrink_to_fit");
+    EXPECT_TRUE(sv_capacity(sv) < before && sv_capacity(sv) >= sv_size(sv), "shrink frees spare segments");
+    ok = 1;
+    for (int i = 0; i < 100; i++)
+        ok &= ptrs[i] == sv_at(sv, i) && *ptrs[i] == i;
+    EXPECT_TRUE(ok, "pointers survive shrink_to_fit");
+
+    EXPECT_EQ_INT(sv_reserve(sv, 50000), 0, "reserve");
+    EXPECT_TRUE(sv_capacity(sv) >= 50000, "capacity after reserve");
+    EXPECT_EQ_INT(sv_clear(sv), 0, "clear");
+    EXPECT_EQ_SIZE(sv_size(sv), 0, "size after clear");
+
+    sv_destroy(sv);
+}
+
+// 4. Worst single push_back against Vector, which copies the array when it grows
+static void test_timed_push_latency(void) {
+    const size_t NUM_ELEMENTS = 4000000;
+    SegVector *sv = sv_create(16, sizeof(int64_t));
+    Vector *v = vec_create(16, sizeof(int64_t));
+    double worst_sv = 0, worst_v = 0, total_sv = 0, total_v = 0;
+
+    for (size_t i = 0; i < NUM_ELEMENTS; i++) {
+        struct timespec a, b, c;
+        int64_t x = (int64_t)i;
+        clock_gettime(1, &a);
+        sv_push_back(sv, &x);
+        clock_gettime(1, &b);
+        v_push_back(v, &x);
+        clock_gettime(1, &c);
+
+        double dsv = (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) / 1e9;
+        double dv = (c.tv_sec - b.tv_sec) + (c.tv_nsec - b.tv_nsec) / 1e9;
+        total_sv += dsv;
+        total_v += dv;
+        if (dsv > worst_sv) worst_sv = dsv;
+        if (dv > worst_v) worst_v = dv;
+    }
+
+    printf("%zu push_backs: SegVector %.3f s (worst %.1f us), Vector %.3f s (worst %.1f us)\n",
+           NUM_ELEMENTS, total_sv, worst_sv * 1e6, total_v, worst_v * 1e6);
+
+    vec_destroy(v);
+    sv_destroy(sv);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_basic_ops();
+    test_stable_addresses();
+    test_timed_push_latency();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,257 @@
+// test_soa.c
+// Tests for the structure-of-arrays container (ds_soa.h): row round trips,
+// column layout and alignment, sorting by one column, and a single-field scan
+// compared with the same records stored array-of-structs in a Vector.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_soa.h"
+#include "../include/ds_vector.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s: condition is false\n", (message)); \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) do {             \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %d, got %d\n",       \
+                (message), (int)(expected), (int)(actual));       \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_SIZE(actual, expected, message) do {            \
+    total_tests++;                                                \
+    if ((actual) != (expected)) {                                 \
+        fprintf(stderr, "[FAIL] %s: expected %zu, got %zu\n",     \
+                (message), (size_t)(expected), (size_t)(actual));\
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+// 128-byte record; scans usually touch only id and price
+typedef struct {
+    int64_t id;
+    double  price;
+    int32_t quantity;
+    char    name[20];
+    double  extra[11];
+} Record;
+
+static const SoaField record_fields[] = {
+    SOA_FIELD(Record, id),
+    SOA_FIELD(Record, price),
+    SOA_FIELD(Record, quantity),
+    SOA_FIELD(Record, name),
+    SOA_FIELD(Record, extra),
+};
+
+#define NUM_RECORD_FIELDS (sizeof(record_fields) / sizeof(record_fields[0]))
+
+enum { F_ID, F_PRICE, F_QUANTITY, F_NAME, F_EXTRA };
+
+static int cmp_int32(void *a, void *b) {
+    int32_t x = *(int32_t *)a, y = *(int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static Record make_record(int64_t i) {
+    Record r;
+    memset(&r, 0, sizeof(r));
+    r.id = i;
+    r.price = (double)(rand() % 10000) / 100.0;
+    r.quantity = rand() % 50;
+    snprintf(r.name, sizeof(r.name), "item-%lld", (long long)i);
+    for (int k = 0; k < 11; k++)
+        r.extra[k] = (double)(i * k);
+    return r;
+}
+
+static int same_record(const Record *a, const Record *b) {
+    return a->id == b->id && a->price == b->price && a->quantity == b->quantity &&
+           strcmp(a->name, b->name) == 0 && memcmp(a->extra, b->extra, sizeof(a->extra)) == 0;
+}
+
+// 1. Schema validation and invalid input
+static void test_invalid_input(void) {
+    SoaField bad = { 120, 16 };
+    Record r;
+
+    EXPECT_TRUE(soa_create(NULL, 1, sizeof(Record), 0) == NULL, "create without schema");
+    EXPECT_TRUE(soa_create(record_fields, 0, sizeof(Record), 0) == NULL, "create without fields");
+    EXPECT_TRUE(soa_create(&bad, 1, sizeof(Record), 0) == NULL, "field past end of record");
+
+    SoaVector *soa = soa_create(record_fields, NUM_RECORD_FIELDS, sizeof(Record), 0);
+    EXPECT_EQ_INT(soa_push_row(soa, NULL), -1, "push_row without record");
+    EXPECT_EQ_INT(soa_get_row(soa, &r, 0), -2, "get_row out of bounds");
+    EXPECT_EQ_INT(soa_set_row(soa, &r, 0), -2, "set_row out of bounds");
+    EXPECT_TRUE(soa_column(soa, NUM_RECORD_FIELDS, NULL) == NULL, "column out of range");
+    EXPECT_EQ_INT(soa_sort_by(soa, 0, NULL), -1, "sort without comparator");
+    EXPECT_EQ_SIZE(soa_num_fields(soa), NUM_RECORD_FIELDS, "num_fields");
+    soa_destroy(soa);
+}
+
+// 2. Rows round trip through the columns, which are aligned and contiguous
+static void test_rows_and_columns(void) {
+    const size_t n = 3000;
+    SoaVector *soa = soa_create(record_fields, NUM_RECORD_FIELDS, sizeof(Record), 4);
+    Record *records = malloc(n * sizeof(Record));
+
+    for (size_t i = 0; i < n; i++)
+        records[i] = make_record((int64_t)i);
+
+    for (size_t i = 0; i < 10; i++)
+        EXPECT_EQ_INT(soa_push_row(soa, &records[i]), 0, "push_row");
+    EXPECT_EQ_INT(soa_append_rows(soa, records + 10, n - 10), 0, "append_rows");
+    EXPECT_EQ_SIZE(soa_size(soa), n, "size after appends");
+    EXPECT_EQ_INT(soa_append_rows(soa, records, SIZE_MAX / 2 + 1), -2, "oversized append_rows fails");
+    EXPECT_EQ_SIZE(soa_size(soa), n, "failed append_rows leaves the size");
+
+    int ok = 1;
+    for (size_t i = 0; i < n; i++) {
+        Record r;
+        soa_get_row(soa, &r, i);
+        ok &= same_record(&r, &records[i]);
+    }
+    EXPECT_TRUE(ok, "gathered rows match");
+
+    size_t count = 0;
+    for (size_t f = 0; f < NUM_RECORD_FIELDS; f++)
+        EXPECT_TRUE(((uintptr_t)soa_column(soa, f, NULL) % 64) == 0, "column is cache line aligned");
+
+    double *prices = soa_column(soa, F_PRICE, &count);
+    EXPECT_EQ_SIZE(count, n, "column count");
+    ok = 1;
+    for (size_t i = 0; i < n; i++)
+        ok &= prices[i] == records[i].price;
+    EXPECT_TRUE(ok, "price column contents");
+
+    Record changed = make_record(-7);
+    EXPECT_EQ_INT(soa_set_row(soa, &changed, 5), 0, "set_row");
+    Record back;
+    soa_get_row(soa, &back, 5);
+    EXPECT_TRUE(same_record(&back, &changed), "row after set_row");
+
+    EXPECT_EQ_INT(soa_reserve(soa, 10000), 0, "reserve");
+    soa_get_row(soa, &back, n - 1);
+    EXPECT_TRUE(same_record(&back, &records[n - 1]), "rows survive reserve");
+    EXPECT_EQ_INT(soa_clear(soa), 0, "clear");
+    EXPECT_EQ_SIZE(soa_size(soa), 0, "size after clear");
+
+    free(records);
+    soa_destroy(soa);
+}
+
+// 3. Sorting by one column moves whole rows and keeps equal keys in order
+static void test_sort_by_column(void) {
+    const size_t n = 5000;
+    SoaVector *soa = soa_create(record_fields, NUM_RECORD_FIELDS, sizeof(Record), 0);
+
+    for (size_t i = 0; i < n; i++) {
+        Record r = make_record((int64_t)i);
+        soa_push_row(soa, &r);
+    }
+
+    EXPECT_EQ_INT(soa_sort_by(soa, F_QUANTITY, cmp_int32), 0, "sort_by return code");
+
+    int ok = 1;
+    int32_t *qty = soa_column(soa, F_QUANTITY, NULL);
+    int64_t *ids = soa_column(soa, F_ID, NULL);
+    for (size_t i = 1; i < n; i++) {
+        ok &= qty[i - 1] <= qty[i];
+        if (qty[i - 1] == qty[i])
+            ok &= ids[i - 1] < ids[i];
+    }
+    EXPECT_TRUE(ok, "sorted by quantity and stable");
+
+    ok = 1;
+    for (size_t i = 0; i < n; i++) {
+        Record r;
+        char expect[20];
+        soa_get_row(soa, &r, i);
+        snprintf(expect, sizeof(expect), "item-%lld", (long long)r.id);
+        ok &= strcmp(r.name, expect) == 0 && r.extra[3] == (double)(r.id * 3);
+    }
+    EXPECT_TRUE(ok, "other columns follow the sort");
+
+    soa_destroy(soa);
+}
+
+// 4. Summing one field: SoA column against AoS records in a Vector
+static void test_timed_column_scan(void) {
+    const size_t NUM_ROWS = 2000000;
+    const int PASSES = 10;
+    SoaVector *soa = soa_create(record_fields, NUM_RECORD_FIELDS, sizeof(Record), NUM_ROWS);
+    Vector *aos = vec_create(NUM_ROWS, sizeof(Record));
+    if (!soa || !aos) {
+        fprintf(stderr, "[ERROR] Could not allocate containers for scan benchmark.\n");
+        soa_destroy(soa);
+        vec_destroy(aos);
+        return;
+    }
+    for (size_t i = 0; i < NUM_ROWS; i++) {
+        Record r = make_record((int64_t)i);
+        soa_push_row(soa, &r);
+        v_push_back(aos, &r);
+    }
+
+    struct timespec start, end;
+    double sum_soa = 0, sum_aos = 0;
+
+    clock_gettime(1, &start);
+    for (int p = 0; p < PASSES; p++) {
+        const double *prices = soa_column(soa, F_PRICE, NULL);
+        for (size_t i = 0; i < NUM_ROWS; i++)
+            sum_soa += prices[i];
+    }
+    clock_gettime(1, &end);
+    double soa_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    clock_gettime(1, &start);
+    for (int p = 0; p < PASSES; p++) {
+        const Record *rows = v_data(aos, NULL);
+        for (size_t i = 0; i < NUM_ROWS; i++)
+            sum_aos += rows[i].price;
+    }
+    clock_gettime(1, &end);
+    double aos_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    EXPECT_TRUE(sum_soa == sum_aos, "SoA and AoS sums agree");
+    printf("Sum of one field over %zu %zu-byte records x%d: SoA %.3f s, AoS %.3f s\n",
+           NUM_ROWS, sizeof(Record), PASSES, soa_sec, aos_sec);
+
+    vec_destroy(aos);
+    soa_destroy(soa);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    test_invalid_input();
+    test_rows_and_columns();
+    test_sort_by_column();
+    test_timed_column_scan();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}
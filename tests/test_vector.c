@@ -12,6 +12,7 @@
 #include <inttypes.h>
 #include <stdint.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #include "../include/ds_vector.h"
 
@@ -270,6 +271,74 @@ static void test_erase(void) {
     vec_destroy(v);
 }
 
+// 6b. Test range operations: v_append_n, v_insert_range, v_erase_range, v_swap_remove, v_remove_if
+static int is_odd(void *elem) {
+    return *(int *)elem % 2 != 0;
+}
+
+static void test_range_operations(void) {
+    Vector *v = vec_create(2, sizeof(int));
+    EXPECT_TRUE(v != NULL, "vec_create for range test should succeed");
+
+    int src[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    int out = 0;
+
+    EXPECT_EQ_INT(v_append_n(NULL, src, 3), -1, "v_append_n(NULL) should return -1");
+    EXPECT_EQ_INT(v_append_n(v, NULL, 3), -1, "v_append_n(v, NULL, 3) should return -1");
+    EXPECT_EQ_INT(v_append_n(v, NULL, 0), 0, "v_append_n of zero elements should succeed");
+
+    // Append grows once to fit the whole range
+    EXPECT_EQ_INT(v_append_n(v, src, 10), 0, "v_append_n should succeed");
+    EXPECT_EQ_SIZE(v_size(v), 10, "Size should be 10 after append_n");
+    EXPECT_TRUE(v_capacity(v) >= 10, "Capacity should fit the appended range");
+
+    // Insert {100, 101, 102} at index 4
+    int ins[] = { 100, 101, 102 };
+    EXPECT_EQ_INT(v_insert_range(v, ins, 3, 11), -2, "v_insert_range OOB should return -2");
+    EXPECT_EQ_INT(v_insert_range(v, ins, 3, 4), 0, "v_insert_range should succeed");
+    EXPECT_EQ_SIZE(v_size(v), 13, "Size should be 13 after insert_range");
+    v_get(v, &out, 3);
+    EXPECT_EQ_INT(out, 3, "Element before inserted range should be unchanged");
+    v_get(v, &out, 5);
+    EXPECT_EQ_INT(out, 101, "Inserted range should be in place");
+    v_get(v, &out, 7);
+    EXPECT_EQ_INT(out, 4, "Tail should shift past inserted range");
+
+    // Erase the inserted range again
+    EXPECT_EQ_INT(v_erase_range(NULL, 0, 1), -1, "v_erase_range(NULL) should return -1");
+    EXPECT_EQ_INT(v_erase_range(v, 12, 2), -2, "v_erase_range past end should return -2");
+    EXPECT_EQ_INT(v_erase_range(v, 4, 3), 0, "v_erase_range should succeed");
+    EXPECT_EQ_SIZE(v_size(v), 10, "Size should be 10 after erase_range");
+    int ok = 1;
+    for (size_t i = 0; i < v_size(v); i++) {
+        v_get(v, &out, i);
+        ok &= out == (int)i;
+    }
+    EXPECT_TRUE(ok, "Contents should match original after insert/erase range");
+
+    // Remove odd values, survivors keep their order
+    EXPECT_EQ_INT(v_remove_if(v, NULL), -1, "v_remove_if without predicate should return -1");
+    EXPECT_EQ_INT(v_remove_if(v, is_odd), 0, "v_remove_if should succeed");
+    EXPECT_EQ_SIZE(v_size(v), 5, "Five even values should remain");
+    ok = 1;
+    for (size_t i = 0; i < v_size(v); i++) {
+        v_get(v, &out, i);
+        ok &= out == (int)(i * 2);
+    }
+    EXPECT_TRUE(ok, "v_remove_if should keep survivors in order");
+
+    // Swap-remove index 1 (value 2): last element (8) takes its place
+    EXPECT_EQ_INT(v_swap_remove(v, 5), -2, "v_swap_remove OOB should return -2");
+    EXPECT_EQ_INT(v_swap_remove(v, 1), 0, "v_swap_remove should succeed");
+    EXPECT_EQ_SIZE(v_size(v), 4, "Size should be 4 after swap_remove");
+    v_get(v, &out, 1);
+    EXPECT_EQ_INT(out, 8, "Last element should fill the removed slot");
+    EXPECT_EQ_INT(v_swap_remove(v, 3), 0, "v_swap_remove of the last element should succeed");
+    EXPECT_EQ_SIZE(v_size(v), 3, "Size should be 3 after removing the last element");
+
+    vec_destroy(v);
+}
+
 // 7. Test v_size, v_capacity, v_empty, v_clear
 static void test_size_capacity_empty_clear(void) {
     Vector *v = vec_create(3, sizeof(int));
@@ -327,6 +396,145 @@ static void test_resize(void) {
     vec_destroy(v);
 }
 
+// 8a. Test growth policies, memory limit, v_reserve and v_shrink_to_fit
+static void test_capacity_management(void) {
+    VecOptions bad = { .growth_factor = 1.0 };
+    EXPECT_TRUE(vec_create_opts(4, sizeof(int), &bad) == NULL, "Growth factor 1.0 should be rejected");
+
+    VecOptions too_small = { .max_bytes = 3 * sizeof(int) };
+    EXPECT_TRUE(vec_create_opts(4, sizeof(int), &too_small) == NULL, "Capacity above max_bytes should be rejected");
+
+    // 1.5x growth
+    VecOptions factor = { .growth_factor = 1.5 };
+    Vector *v = vec_create_opts(4, sizeof(int), &factor);
+    EXPECT_TRUE(v != NULL, "vec_create_opts with 1.5x growth should succeed");
+    for (int i = 0; i < 5; i++)
+        v_push_back(v, &i);
+    EXPECT_EQ_SIZE(v_capacity(v), 6, "Capacity should grow 4 -> 6 with 1.5x growth");
+    vec_destroy(v);
+
+    // Fixed chunk growth
+    VecOptions chunk = { .growth_chunk = 10 };
+    v = vec_create_opts(4, sizeof(int), &chunk);
+    EXPECT_TRUE(v != NULL, "vec_create_opts with chunk growth should succeed");
+    for (int i = 0; i < 5; i++)
+        v_push_back(v, &i);
+    EXPECT_EQ_SIZE(v_capacity(v), 14, "Capacity should grow 4 -> 14 with chunk growth");
+    vec_destroy(v);
+
+    // Hard limit: growth is clamped to the limit, then fails cleanly
+    VecOptions limit = { .max_bytes = 8 * sizeof(int) };
+    v = vec_create_opts(5, sizeof(int), &limit);
+    EXPECT_TRUE(v != NULL, "vec_create_opts with memory limit should succeed");
+    for (int i = 0; i < 8; i++)
+        EXPECT_EQ_INT(v_push_back(v, &i), 0, "Push below the limit should succeed");
+    EXPECT_EQ_SIZE(v_capacity(v), 8, "Capacity should be clamped to the limit");
+    int extra = 8;
+    EXPECT_EQ_INT(v_push_back(v, &extra), -2, "Push past the limit should return -2");
+    EXPECT_EQ_SIZE(v_size(v), 8, "Failed push should not change size");
+    EXPECT_EQ_INT(v_reserve(v, 9), -2, "v_reserve past the limit should return -2");
+    vec_destroy(v);
+
+    // v_reserve and v_shrink_to_fit
+    v = vec_create(2, sizeof(int));
+    EXPECT_EQ_INT(v_reserve(NULL, 10), -1, "v_reserve(NULL) should return -1");
+    EXPECT_EQ_INT(v_reserve(v, 100), 0, "v_reserve should succeed");
+    EXPECT_EQ_SIZE(v_capacity(v), 100, "Capacity should be 100 after reserve");
+    EXPECT_EQ_INT(v_reserve(v, 10), 0, "v_reserve smaller than capacity should succeed");
+    EXPECT_EQ_SIZE(v_capacity(v), 100, "v_reserve should never shrink");
+    for (int i = 0; i < 7; i++)
+        v_push_back(v, &i);
+    EXPECT_EQ_INT(v_shrink_to_fit(NULL), -1, "v_shrink_to_fit(NULL) should return -1");
+    EXPECT_EQ_INT(v_shrink_to_fit(v), 0, "v_shrink_to_fit should succeed");
+    EXPECT_EQ_SIZE(v_capacity(v), 7, "Capacity should equal size after shrink_to_fit");
+    EXPECT_EQ_SIZE(v_size(v), 7, "v_shrink_to_fit should keep every element");
+    int out = 0;
+    v_get(v, &out, 6);
+    EXPECT_EQ_INT(out, 6, "Contents should survive shrink_to_fit");
+    v_clear(v);
+    EXPECT_EQ_INT(v_shrink_to_fit(v), 0, "v_shrink_to_fit on empty vector should succeed");
+    EXPECT_EQ_SIZE(v_capacity(v), 1, "Empty vector should keep capacity 1");
+    vec_destroy(v);
+}
+
+// 8c. Test an mmap-backed vector (falls back to malloc off Linux)
+static void test_mmap_backed(void) {
+    VecOptions opts = { .use_mmap = 1 };
+    Vector *v = vec_create_opts(16, sizeof(int), &opts);
+    EXPECT_TRUE(v != NULL, "vec_create_opts with use_mmap should succeed");
+    if (!v) return;
+
+    // Grow through many remaps
+    int ok = 1;
+    for (int i = 0; i < 1000000; i++)
+        ok &= v_push_back(v, &i) == 0;
+    EXPECT_TRUE(ok, "v_push_back into mmap-backed vector should succeed");
+
+    int out = 0;
+    ok = 1;
+    for (size_t i = 0; i < v_size(v); i += 997) {
+        v_get(v, &out, i);
+        ok &= out == (int)i;
+    }
+    EXPECT_TRUE(ok, "Contents should survive mmap growth");
+
+    EXPECT_EQ_INT(v_shrink_to_fit(v), 0, "v_shrink_to_fit on mmap-backed vector should succeed");
+    v_get(v, &out, 999999);
+    EXPECT_EQ_INT(out, 999999, "Last element should survive shrink");
+
+    // Clear releases the pages; the vector must remain usable
+    EXPECT_EQ_INT(v_clear(v), 0, "v_clear on mmap-backed vector should succeed");
+    int val = 7;
+    EXPECT_EQ_INT(v_push_back(v, &val), 0, "Push after clear should succeed");
+    v_get(v, &out, 0);
+    EXPECT_EQ_INT(out, 7, "Value pushed after clear should be readable");
+
+    vec_destroy(v);
+}
+
+// 8b. Test zero-copy access: v_at, v_back, v_data, v_emplace_back
+static void test_zero_copy_access(void) {
+    Vector *v = vec_create(2, sizeof(Pair));
+    EXPECT_TRUE(v != NULL, "vec_create for zero-copy test should succeed");
+
+    size_t len = 99;
+    EXPECT_TRUE(v_at(NULL, 0) == NULL, "v_at(NULL) should return NULL");
+    EXPECT_TRUE(v_at(v, 0) == NULL, "v_at on empty vector should return NULL");
+    EXPECT_TRUE(v_back(v) == NULL, "v_back on empty vector should return NULL");
+    EXPECT_TRUE(v_emplace_back(NULL) == NULL, "v_emplace_back(NULL) should return NULL");
+    EXPECT_TRUE(v_data(NULL, &len) == NULL && len == 0, "v_data(NULL) should return NULL and length 0");
+
+    // Emplace past the initial capacity to force growth
+    for (int i = 0; i < 5; i++) {
+        Pair *slot = v_emplace_back(v);
+        EXPECT_TRUE(slot != NULL, "v_emplace_back should return a slot");
+        if (slot) {
+            slot->key = i;
+            slot->value = i * 10;
+        }
+    }
+    EXPECT_EQ_SIZE(v_size(v), 5, "Size should be 5 after emplacing");
+
+    Pair *p = v_at(v, 3);
+    EXPECT_TRUE(p != NULL && p->value == 30, "v_at should point at element 3");
+    EXPECT_TRUE(v_at(v, 5) == NULL, "v_at OOB should return NULL");
+
+    // Writes through the pointer are visible to v_get
+    if (p) p->value = 333;
+    Pair out;
+    v_get(v, &out, 3);
+    EXPECT_EQ_INT(out.value, 333, "Write through v_at pointer should be visible");
+
+    Pair *back = v_back(v);
+    EXPECT_TRUE(back != NULL && back->key == 4, "v_back should point at the last element");
+
+    Pair *data = v_data(v, &len);
+    EXPECT_EQ_SIZE(len, 5, "v_data should report the element count");
+    EXPECT_TRUE(data != NULL && data[1].value == 10 && data == v_at(v, 0), "v_data should return the array start");
+
+    vec_destroy(v);
+}
+
 // 9. Test v_sort on ints (empty, small, large)
 static void test_sort_integers(void) {
     Vector *v = vec_create(5, sizeof(int));
@@ -393,7 +601,379 @@ static void test_sort_structs(void) {
     vec_destroy(vsp);
 }
 
-// 11. Stress test: random push/pop/get operations
+// 11. Test v_sort_radix on signed, floating point and embedded keys
+typedef struct {
+    uint32_t id;
+    double   score;
+    char     pad[4];
+} Record;
+
+static void test_sort_radix(void) {
+    Vector *v = vec_create(16, sizeof(int));
+    EXPECT_TRUE(v != NULL, "vec_create for radix sort test should succeed");
+
+    EXPECT_EQ_INT(v_sort_radix(NULL, 0, V_KEY_I32), -1, "v_sort_radix(NULL) should return -1");
+    EXPECT_EQ_INT(v_sort_radix(v, 1, V_KEY_I32), -1, "Key past element end should return -1");
+    EXPECT_EQ_INT(v_sort_radix(v, 0, V_KEY_I64), -1, "Key wider than element should return -1");
+    EXPECT_EQ_INT(v_sort_radix(v, 0, V_KEY_I32), 0, "v_sort_radix on empty should return 0");
+
+    // Signed ints with negatives, duplicates and extremes
+    for (int i = 0; i < 1000; i++) {
+        int r = rand() % 20000 - 10000;
+        if (i == 10) r = INT32_MIN;
+        if (i == 20) r = INT32_MAX;
+        EXPECT_EQ_INT(v_push_back(v, &r), 0, "v_push_back for radix sort");
+    }
+    EXPECT_EQ_INT(v_sort_radix(v, 0, V_KEY_I32), 0, "v_sort_radix on ints should succeed");
+    int prev = INT32_MIN, curr = 0;
+    for (size_t i = 0; i < v_size(v); i++) {
+        v_get(v, &curr, i);
+        EXPECT_TRUE(prev <= curr, "Ints should be sorted by v_sort_radix");
+        prev = curr;
+    }
+    vec_destroy(v);
+
+    // Records keyed by a double at a non-zero offset; ids check stability
+    Vector *vr = vec_create(16, sizeof(Record));
+    EXPECT_TRUE(vr != NULL, "vec_create for record radix sort should succeed");
+    for (uint32_t i = 0; i < 500; i++) {
+        Record r = { .id = i, .score = (double)(rand() % 50 - 25) / 4.0 };
+        EXPECT_EQ_INT(v_push_back(vr, &r), 0, "v_push_back for record radix sort");
+    }
+    EXPECT_EQ_INT(v_sort_radix(vr, offsetof(Record, score), V_KEY_F64), 0,
+                  "v_sort_radix on double key should succeed");
+    Record a, b;
+    for (size_t i = 1; i < v_size(vr); i++) {
+        v_get(vr, &a, i - 1);
+        v_get(vr, &b, i);
+        EXPECT_TRUE(a.score <= b.score, "Records should be sorted by score");
+        if (a.score == b.score)
+            EXPECT_TRUE(a.id < b.id, "Equal keys should keep their original order");
+    }
+    vec_destroy(vr);
+}
+
+// 12. Test v_sort_parallel (invalid input, serial fallback, multi-threaded)
+static void test_sort_parallel(void) {
+    Vector *v = vec_create(16, sizeof(int));
+    EXPECT_TRUE(v != NULL, "vec_create for parallel sort test should succeed");
+
+    EXPECT_EQ_INT(v_sort_parallel(NULL, cmp_int, 4), -1, "v_sort_parallel(NULL) should return -1");
+    EXPECT_EQ_INT(v_sort_parallel(v, NULL, 4), -1, "v_sort_parallel(v, NULL) should return -1");
+    EXPECT_EQ_INT(v_sort_parallel(v, cmp_int, 4), 0, "v_sort_parallel on empty should return 0");
+
+    // Small vector takes the serial path
+    for (int i = 0; i < 500; i++) {
+        int r = rand() % 1000;
+        v_push_back(v, &r);
+    }
+    EXPECT_EQ_INT(v_sort_parallel(v, cmp_int, 4), 0, "v_sort_parallel small vector should succeed");
+    int prev = INT32_MIN, curr = 0;
+    for (size_t i = 0; i < v_size(v); i++) {
+        v_get(v, &curr, i);
+        EXPECT_TRUE(prev <= curr, "Small vector should be sorted");
+        prev = curr;
+    }
+
+    // Large vector with an odd thread count exercises the unpaired run
+    v_clear(v);
+    long long sum_before = 0, sum_after = 0;
+    for (int i = 0; i < 400000; i++) {
+        int r = rand() % 100000 - 50000;
+        sum_before += r;
+        v_push_back(v, &r);
+    }
+    EXPECT_EQ_INT(v_sort_parallel(v, cmp_int, 3), 0, "v_sort_parallel large vector should succeed");
+    prev = INT32_MIN;
+    int sorted = 1;
+    for (size_t i = 0; i < v_size(v); i++) {
+        v_get(v, &curr, i);
+        sorted &= prev <= curr;
+        sum_after += curr;
+        prev = curr;
+    }
+    EXPECT_TRUE(sorted, "Large vector should be sorted by v_sort_parallel");
+    EXPECT_TRUE(sum_before == sum_after, "v_sort_parallel should keep every element");
+    EXPECT_EQ_SIZE(v_size(v), 400000, "v_sort_parallel should not change size");
+
+    // Presorted, reversed and all-equal input must not degrade the chunk sorts
+    const char *shapes[] = { "Presorted", "Reversed", "All-equal" };
+    for (int shape = 0; shape < 3; shape++) {
+        v_clear(v);
+        for (int i = 0; i < 1000000; i++) {
+            int x = shape == 0 ? i : shape == 1 ? 1000000 - i : 7;
+            v_push_back(v, &x);
+        }
+        EXPECT_EQ_INT(v_sort_parallel(v, cmp_int, 4), 0, shapes[shape]);
+        int *arr = v_data(v, NULL);
+        sorted = 1;
+        for (size_t i = 1; i < v_size(v); i++)
+            sorted &= arr[i - 1] <= arr[i];
+        EXPECT_TRUE(sorted, shapes[shape]);
+    }
+
+    vec_destroy(v);
+}
+
+// 13. Test v_stable_sort (stability, presorted and reversed input)
+static void test_stable_sort(void) {
+    Vector *v = vec_create(16, sizeof(Pair));
+    EXPECT_TRUE(v != NULL, "vec_create for stable sort test should succeed");
+
+    EXPECT_EQ_INT(v_stable_sort(NULL, cmp_pair_by_value), -1, "v_stable_sort(NULL) should return -1");
+    EXPECT_EQ_INT(v_stable_sort(v, NULL), -1, "v_stable_sort(v, NULL) should return -1");
+    EXPECT_EQ_INT(v_stable_sort(v, cmp_pair_by_value), 0, "v_stable_sort on empty should return 0");
+
+    // Random values with many duplicates, keys record the original order
+    for (int i = 0; i < 5000; i++) {
+        Pair p = { .key = i, .value = rand() % 100 };
+        v_push_back(v, &p);
+    }
+    EXPECT_EQ_INT(v_stable_sort(v, cmp_pair_by_value), 0, "v_stable_sort random should succeed");
+    Pair a, b;
+    int stable = 1;
+    for (size_t i = 1; i < v_size(v); i++) {
+        v_get(v, &a, i - 1);
+        v_get(v, &b, i);
+        stable &= a.value < b.value || (a.value == b.value && a.key < b.key);
+    }
+    EXPECT_TRUE(stable, "v_stable_sort should order by value and keep ties in order");
+
+    // Descending runs followed by an ascending run
+    v_clear(v);
+    for (int i = 0; i < 3000; i++) {
+        Pair p = { .key = i, .value = i < 2000 ? 2000 - i : i };
+        v_push_back(v, &p);
+    }
+    EXPECT_EQ_INT(v_stable_sort(v, cmp_pair_by_value), 0, "v_stable_sort runs should succeed");
+    int sorted = 1;
+    for (size_t i = 1; i < v_size(v); i++) {
+        v_get(v, &a, i - 1);
+        v_get(v, &b, i);
+        sorted &= a.value <= b.value;
+    }
+    EXPECT_TRUE(sorted, "v_stable_sort should sort presorted runs");
+
+    vec_destroy(v);
+}
+
+// 14. Test v_argsort with and without applying the permutation
+static void test_argsort(void) {
+    Vector *v = vec_create(16, sizeof(Pair));
+    EXPECT_TRUE(v != NULL, "vec_create for argsort test should succeed");
+
+    size_t indices[1000];
+    EXPECT_EQ_INT(v_argsort(NULL, cmp_pair_by_value, indices, 0), -1, "v_argsort(NULL) should return -1");
+    EXPECT_EQ_INT(v_argsort(v, cmp_pair_by_value, NULL, 0), -1, "v_argsort without indices should return -1");
+
+    for (int i = 0; i < 1000; i++) {
+        Pair p = { .key = i, .value = rand() % 50 };
+        v_push_back(v, &p);
+    }
+
+    // Indices only: records must not move
+    EXPECT_EQ_INT(v_argsort(v, cmp_pair_by_value, indices, 0), 0, "v_argsort should succeed");
+    Pair a, b;
+    int ordered = 1, unmoved = 1;
+    for (size_t i = 0; i < v_size(v); i++) {
+        v_get(v, &a, i);
+        unmoved &= a.key == (int)i;
+        if (i > 0) {
+            v_get(v, &a, indices[i - 1]);
+            v_get(v, &b, indices[i]);
+            ordered &= a.value < b.value || (a.value == b.value && indices[i - 1] < indices[i]);
+        }
+    }
+    EXPECT_TRUE(unmoved, "v_argsort without apply should not move records");
+    EXPECT_TRUE(ordered, "v_argsort indices should give a stable sorted order");
+
+    // Apply the permutation in place
+    EXPECT_EQ_INT(v_argsort(v, cmp_pair_by_value, indices, 1), 0, "v_argsort with apply should succeed");
+    int applied = 1;
+    for (size_t i = 0; i < v_size(v); i++) {
+        v_get(v, &a, i);
+        applied &= a.key == (int)indices[i];
+        if (i > 0) {
+            v_get(v, &b, i - 1);
+            applied &= b.value <= a.value;
+        }
+    }
+    EXPECT_TRUE(applied, "v_argsort apply should reorder records to match indices");
+
+    vec_destroy(v);
+}
+
+// 15. Test v_lower_bound, v_upper_bound and v_equal_range against a linear scan
+static void test_binary_search(void) {
+    Vector *v = vec_create(16, sizeof(int));
+    EXPECT_TRUE(v != NULL, "vec_create for binary search test should succeed");
+
+    int key = 0;
+    size_t idx = 99, first = 0, last = 0;
+    EXPECT_EQ_INT(v_lower_bound(NULL, &key, cmp_int, &idx), -1, "v_lower_bound(NULL) should return -1");
+    EXPECT_EQ_INT(v_upper_bound(v, &key, NULL, &idx), -1, "v_upper_bound without cmp should return -1");
+    EXPECT_EQ_INT(v_lower_bound(v, &key, cmp_int, &idx), 0, "v_lower_bound on empty should succeed");
+    EXPECT_EQ_SIZE(idx, 0, "v_lower_bound on empty should return 0");
+
+    for (int i = 0; i < 300; i++) {
+        int r = rand() % 100;
+        v_push_back(v, &r);
+    }
+    v_sort(v, cmp_int);
+    int *data = v_data(v, NULL);
+
+    int ok = 1;
+    for (key = -1; key <= 100; key++) {
+        size_t lo = 0, hi = 0;
+        while (lo < v_size(v) && data[lo] < key) lo++;
+        hi = lo;
+        while (hi < v_size(v) && data[hi] == key) hi++;
+
+        v_lower_bound(v, &key, cmp_int, &idx);
+        ok &= idx == lo;
+        v_upper_bound(v, &key, cmp_int, &idx);
+        ok &= idx == hi;
+        v_equal_range(v, &key, cmp_int, &first, &last);
+        ok &= first == lo && last == hi;
+    }
+    EXPECT_TRUE(ok, "Bounds should match a linear scan");
+
+    vec_destroy(v);
+}
+
+// 16. Test the Eytzinger search index on signed, unsigned and floating point keys
+static void test_eytzinger(void) {
+    EXPECT_TRUE(v_eytzinger_build(NULL, 0, V_KEY_I32) == NULL, "v_eytzinger_build(NULL) should return NULL");
+
+    static const size_t sizes[] = { 0, 1, 2, 7, 8, 100, 1023, 5000 };
+    int ok = 1;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        Vector *vi = vec_create(16, sizeof(int32_t));
+        Vector *vd = vec_create(16, sizeof(double));
+        Vector *vu = vec_create(16, sizeof(uint64_t));
+        for (size_t i = 0; i < sizes[s]; i++) {
+            int32_t x = rand() % 2000 - 1000;
+            double d = (rand() % 2000 - 1000) / 8.0;
+            uint64_t u = (uint64_t)rand() << 33;
+            v_push_back(vi, &x);
+            v_push_back(vd, &d);
+            v_push_back(vu, &u);
+        }
+        v_sort_radix(vi, 0, V_KEY_I32);
+        v_sort_radix(vd, 0, V_KEY_F64);
+        v_sort_radix(vu, 0, V_KEY_U64);
+
+        VecEytzinger *ei = v_eytzinger_build(vi, 0, V_KEY_I32);
+        VecEytzinger *ed = v_eytzinger_build(vd, 0, V_KEY_F64);
+        VecEytzinger *eu = v_eytzinger_build(vu, 0, V_KEY_U64);
+        EXPECT_TRUE(ei && ed && eu, "v_eytzinger_build should succeed");
+        if (!ei || !ed || !eu) break;
+
+        int32_t *di = v_data(vi, NULL);
+        double *dd = v_data(vd, NULL);
+        uint64_t *du = v_data(vu, NULL);
+        for (int q = 0; q < 200; q++) {
+            int32_t xi = rand() % 2200 - 1100;
+            double xd = (rand() % 2200 - 1100) / 8.0;
+            uint64_t xu = (uint64_t)rand() << 33;
+            size_t got, want;
+
+            v_eytzinger_lower_bound(ei, &xi, &got);
+            for (want = 0; want < sizes[s] && di[want] < xi; want++);
+            ok &= got == want;
+
+            v_eytzinger_lower_bound(ed, &xd, &got);
+            for (want = 0; want < sizes[s] && dd[want] < xd; want++);
+            ok &= got == want;
+
+            v_eytzinger_lower_bound(eu, &xu, &got);
+            for (want = 0; want < sizes[s] && du[want] < xu; want++);
+            ok &= got == want;
+        }
+
+        v_eytzinger_destroy(ei);
+        v_eytzinger_destroy(ed);
+        v_eytzinger_destroy(eu);
+        vec_destroy(vi);
+        vec_destroy(vd);
+        vec_destroy(vu);
+    }
+    EXPECT_TRUE(ok, "Eytzinger lower bound should match a linear scan");
+}
+
+// 17. Test v_nth_element, v_partial_sort and v_top_k against a fully sorted copy
+static void test_selection(void) {
+    Vector *v = vec_create(16, sizeof(int));
+    EXPECT_TRUE(v != NULL, "vec_create for selection test should succeed");
+
+    int dest[64];
+    EXPECT_EQ_INT(v_nth_element(NULL, 0, cmp_int), -1, "v_nth_element(NULL) should return -1");
+    EXPECT_EQ_INT(v_nth_element(v, 0, cmp_int), -2, "v_nth_element on empty should return -2");
+    EXPECT_EQ_INT(v_partial_sort(v, 5, NULL), -1, "v_partial_sort without cmp should return -1");
+    EXPECT_EQ_INT(v_top_k(v, 5, cmp_int, NULL), -1, "v_top_k without dest should return -1");
+    EXPECT_EQ_INT(v_top_k(v, 5, cmp_int, dest), 0, "v_top_k on empty should succeed");
+
+    // Random data, all-equal data and presorted data
+    for (int pattern = 0; pattern < 3; pattern++) {
+        const int N = 5000;
+        int *sorted = malloc(N * sizeof(int));
+        v_clear(v);
+        for (int i = 0; i < N; i++) {
+            int x = pattern == 0 ? rand() % 1000 : pattern == 1 ? 7 : i;
+            sorted[i] = x;
+            v_push_back(v, &x);
+        }
+        Vector *copy = vec_create(N, sizeof(int));
+        v_append_n(copy, v_data(v, NULL), N);
+        Vector *sorted_vec = vec_create(N, sizeof(int));
+        v_append_n(sorted_vec, sorted, N);
+        v_stable_sort(sorted_vec, cmp_int);
+        int *ref = v_data(sorted_vec, NULL);
+
+        // nth_element: nth in place, nothing smaller after, nothing larger before
+        size_t nth = (size_t)(rand() % N);
+        EXPECT_EQ_INT(v_nth_element(v, nth, cmp_int), 0, "v_nth_element should succeed");
+        int *data = v_data(v, NULL);
+        int ok = data[nth] == ref[nth];
+        for (size_t i = 0; i < (size_t)N; i++)
+            ok &= i < nth ? data[i] <= data[nth] : data[i] >= data[nth];
+        EXPECT_TRUE(ok, "v_nth_element should partition around the nth element");
+
+        // partial_sort: prefix of 100 matches the sorted prefix
+        EXPECT_EQ_INT(v_partial_sort(v, 100, cmp_int), 0, "v_partial_sort should succeed");
+        ok = 1;
+        for (size_t i = 0; i < 100; i++)
+            ok &= data[i] == ref[i];
+        EXPECT_TRUE(ok, "v_partial_sort prefix should be sorted smallest elements");
+
+        // top_k: smallest 64 in order, source untouched
+        EXPECT_EQ_INT(v_top_k(copy, 64, cmp_int, dest), 0, "v_top_k should succeed");
+        ok = 1;
+        for (size_t i = 0; i < 64; i++)
+            ok &= dest[i] == ref[i];
+        EXPECT_TRUE(ok, "v_top_k should return the smallest k in order");
+        EXPECT_TRUE(memcmp(v_data(copy, NULL), sorted, N * sizeof(int)) == 0, "v_top_k should not modify the vector");
+
+        vec_destroy(copy);
+        vec_destroy(sorted_vec);
+        free(sorted);
+    }
+
+    // k larger than the vector selects everything
+    v_clear(v);
+    for (int i = 5; i > 0; i--)
+        v_push_back(v, &i);
+    EXPECT_EQ_INT(v_top_k(v, 10, cmp_int, dest), 0, "v_top_k with k > size should succeed");
+    EXPECT_TRUE(dest[0] == 1 && dest[4] == 5, "v_top_k with k > size should return all elements sorted");
+    EXPECT_EQ_INT(v_partial_sort(v, 10, cmp_int), 0, "v_partial_sort with k > size should succeed");
+    int out = 0;
+    v_get(v, &out, 4);
+    EXPECT_EQ_INT(out, 5, "v_partial_sort with k > size should sort everything");
+
+    vec_destroy(v);
+}
+
+// 18. Stress test: random push/pop/get operations
 static void test_stress_operations(void) {
     Vector *v = vec_create(10, sizeof(int));
     EXPECT_TRUE(v != NULL, "vec_create for stress test should succeed");
@@ -470,6 +1050,146 @@ static void test_timed_insert_erase(void) {
     vec_destroy(v);
 }
 
+static void test_timed_sort_parallel(void) {
+    const size_t NUM_ELEMENTS = 4000000;
+    const size_t THREADS[] = { 1, 2, 4, 8 };
+
+    int *data = malloc(NUM_ELEMENTS * sizeof(int));
+    Vector *v = vec_create(NUM_ELEMENTS, sizeof(int));
+    if (!data || !v) {
+        fprintf(stderr, "[ERROR] Could not allocate vector for parallel sort benchmark.\n");
+        free(data);
+        if (v) vec_destroy(v);
+        return;
+    }
+
+    for (size_t i = 0; i < NUM_ELEMENTS; i++)
+        data[i] = rand();
+
+    // Scaling curve: same input sorted with an increasing number of threads
+    for (size_t t = 0; t < sizeof(THREADS) / sizeof(THREADS[0]); t++) {
+        v_clear(v);
+        for (size_t i = 0; i < NUM_ELEMENTS; i++)
+            v_push_back(v, &data[i]);
+
+        struct timespec start, end;
+        clock_gettime(1, &start);
+        v_sort_parallel(v, cmp_int, THREADS[t]);
+        clock_gettime(1, &end);
+
+        double elapsed_sec = (end.tv_sec - start.tv_sec)
+                           + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+        printf("Sorted %zu ints with %zu thread(s) in %.3f seconds\n",
+               NUM_ELEMENTS, THREADS[t], elapsed_sec);
+    }
+
+    free(data);
+    vec_destroy(v);
+}
+
+typedef struct {
+    int  key;
+    char payload[508];
+} BigRecord;
+
+static int cmp_big_record(void *a, void *b) {
+    int ka = ((BigRecord *)a)->key;
+    int kb = ((BigRecord *)b)->key;
+    return (ka < kb) ? -1 : (ka > kb);
+}
+
+static void test_timed_argsort(void) {
+    const size_t NUM_RECORDS = 50000;
+
+    Vector *v1 = vec_create(NUM_RECORDS, sizeof(BigRecord));
+    Vector *v2 = vec_create(NUM_RECORDS, sizeof(BigRecord));
+    size_t *indices = malloc(NUM_RECORDS * sizeof(size_t));
+    if (!v1 || !v2 || !indices) {
+        fprintf(stderr, "[ERROR] Could not allocate vectors for argsort benchmark.\n");
+        if (v1) vec_destroy(v1);
+        if (v2) vec_destroy(v2);
+        free(indices);
+        return;
+    }
+
+    BigRecord r;
+    memset(&r, 0, sizeof(r));
+    for (size_t i = 0; i < NUM_RECORDS; i++) {
+        r.key = rand();
+        v_push_back(v1, &r);
+        v_push_back(v2, &r);
+    }
+
+    struct timespec start, mid, end;
+    clock_gettime(1, &start);
+    v_sort(v1, cmp_big_record);
+    clock_gettime(1, &mid);
+    v_argsort(v2, cmp_big_record, indices, 1);
+    clock_gettime(1, &end);
+
+    printf("Sorted %zu 512-byte records: v_sort %.3f s, v_argsort+apply %.3f s\n",
+           NUM_RECORDS,
+           (mid.tv_sec - start.tv_sec) + (mid.tv_nsec - start.tv_nsec) / 1e9,
+           (end.tv_sec - mid.tv_sec) + (end.tv_nsec - mid.tv_nsec) / 1e9);
+
+    free(indices);
+    vec_destroy(v1);
+    vec_destroy(v2);
+}
+
+static void test_timed_search(void) {
+    const size_t NUM_ELEMENTS = 8000000;
+    const size_t NUM_QUERIES = 2000000;
+
+    Vector *v = vec_create(NUM_ELEMENTS, sizeof(int));
+    int *queries = malloc(NUM_QUERIES * sizeof(int));
+    if (!v || !queries) {
+        fprintf(stderr, "[ERROR] Could not allocate vector for search benchmark.\n");
+        if (v) vec_destroy(v);
+        free(queries);
+        return;
+    }
+
+    for (size_t i = 0; i < NUM_ELEMENTS; i++) {
+        int x = (int)(i * 2);
+        v_push_back(v, &x);
+    }
+    for (size_t i = 0; i < NUM_QUERIES; i++)
+        queries[i] = rand() % (int)(NUM_ELEMENTS * 2);
+
+    VecEytzinger *ez = v_eytzinger_build(v, 0, V_KEY_I32);
+    if (!ez) {
+        free(queries);
+        vec_destroy(v);
+        return;
+    }
+
+    struct timespec start, mid, end;
+    size_t idx, check = 0;
+    clock_gettime(1, &start);
+    for (size_t i = 0; i < NUM_QUERIES; i++) {
+        v_lower_bound(v, &queries[i], cmp_int, &idx);
+        check += idx;
+    }
+    clock_gettime(1, &mid);
+    for (size_t i = 0; i < NUM_QUERIES; i++) {
+        v_eytzinger_lower_bound(ez, &queries[i], &idx);
+        check -= idx;
+    }
+    clock_gettime(1, &end);
+
+    printf("%zu lookups in %zu ints: v_lower_bound %.3f s, Eytzinger %.3f s%s\n",
+           NUM_QUERIES, NUM_ELEMENTS,
+           (mid.tv_sec - start.tv_sec) + (mid.tv_nsec - start.tv_nsec) / 1e9,
+           (end.tv_sec - mid.tv_sec) + (end.tv_nsec - mid.tv_nsec) / 1e9,
+           check == 0 ? "" : " (MISMATCH)");
+
+    v_eytzinger_destroy(ez);
+    free(queries);
+    vec_destroy(v);
+}
+
 int main(void) {
     srand((unsigned)time(NULL));
 
@@ -480,13 +1200,27 @@ int main(void) {
     test_get_and_set();
     test_insert();
     test_erase();
+    test_range_operations();
     test_size_capacity_empty_clear();
     test_resize();
+    test_capacity_management();
+    test_mmap_backed();
+    test_zero_copy_access();
     test_sort_integers();
     test_sort_structs();
+    test_sort_radix();
+    test_sort_parallel();
+    test_stable_sort();
+    test_argsort();
+    test_binary_search();
+    test_eytzinger();
+    test_selection();
     test_stress_operations();
 
     test_timed_insert_erase();
+    test_timed_sort_parallel();
+    test_timed_argsort();
+    test_timed_search();
 
     // Print summary
     printf("\n========== Test Summary ==========\n");
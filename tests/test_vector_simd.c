@@ -0,0 +1,188 @@
+// test_vector_simd.c
+// Tests for the SIMD search and reduction kernels (ds_vector_simd.h).
+// Every kernel is run at each instruction set level the CPU supports and
+// checked against a plain loop over the same data.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "../include/ds_vector_simd.h"
+
+static int total_tests = 0;
+static int failed_tests = 0;
+
+#define EXPECT_TRUE(cond, message) do {                           \
+    total_tests++;                                                \
+    if (!(cond)) {                                                \
+        fprintf(stderr, "[FAIL] %s (level %d)\n", (message),      \
+                (int)v_simd_level());                             \
+        failed_tests++;                                           \
+    }                                                              \
+} while (0)
+
+#define EXPECT_EQ_INT(actual, expected, message) \
+    EXPECT_TRUE((actual) == (expected), message)
+
+// Reference checks shared by all element types
+#define CHECK_TYPE(T, KEY, ACC_T, gen)                                                  \
+static void check_##KEY(size_t n) {                                                     \
+    Vector *v = vec_create(n ? n : 1, sizeof(T));                                       \
+    for (size_t i = 0; i < n; i++) {                                                    \
+        T x = (T)(gen);                                                                 \
+        v_push_back(v, &x);                                                             \
+    }                                                                                   \
+    T *data = v_data(v, NULL);                                                          \
+    T probe = n ? data[n / 2] : (T)1;                                                   \
+                                                                                        \
+    size_t idx = 0, expect_idx = n, count = 0, expect_count = 0;                        \
+    for (size_t i = 0; i < n; i++) {                                                    \
+        if (data[i] == probe) {                                                         \
+            if (expect_idx == n) expect_idx = i;                                        \
+            expect_count++;                                                             \
+        }                                                                               \
+    }                                                                                   \
+    int rc = v_find_value(v, KEY, &probe, &idx);                                        \
+    EXPECT_EQ_INT(rc, n ? 0 : 1, #KEY " find return code");                             \
+    if (n) EXPECT_TRUE(idx == expect_idx, #KEY " find index");                          \
+    EXPECT_EQ_INT(v_count_value(v, KEY, &probe, &count), 0, #KEY " count return code"); \
+    EXPECT_TRUE(count == expect_count, #KEY " count value");                            \
+                                                                                        \
+    uint64_t mask[64];                                                                  \
+    for (int op = V_CMP_EQ; op <= V_CMP_GE; op++) {                                     \
+        memset(mask, 0, sizeof(mask));                                                  \
+        EXPECT_EQ_INT(v_compare_mask(v, KEY, (VecCmpOp)op, &probe, mask), 0,            \
+                      #KEY " compare mask return code");                                \
+        int ok = 1;                                                                     \
+        for (size_t i = 0; i < n; i++) {                                                \
+            T a = data[i];                                                              \
+            int want = op == V_CMP_EQ ? a == probe : op == V_CMP_NE ? a != probe :      \
+                       op == V_CMP_LT ? a < probe  : op == V_CMP_LE ? a <= probe :      \
+                       op == V_CMP_GT ? a > probe  : a >= probe;                        \
+            ok &= (int)((mask[i / 64] >> (i % 64)) & 1) == want;                        \
+        }                                                                               \
+        EXPECT_TRUE(ok, #KEY " compare mask bits");                                     \
+    }                                                                                   \
+                                                                                        \
+    size_t imin = 0, imax = 0, emin = 0, emax = 0;                                      \
+    for (size_t i = 1; i < n; i++) {                                                    \
+        if (data[i] < data[emin]) emin = i;                                             \
+        if (data[i] > data[emax]) emax = i;                                             \
+    }                                                                                   \
+    rc = v_min_max(v, KEY, &imin, &imax);                                               \
+    EXPECT_EQ_INT(rc, n ? 0 : 1, #KEY " min/max return code");                          \
+    if (n) EXPECT_TRUE(imin == emin && imax == emax, #KEY " min/max index");            \
+                                                                                        \
+    ACC_T sum = 0, expect_sum = 0;                                                      \
+    for (size_t i = 0; i < n; i++)                                                      \
+        expect_sum += (ACC_T)data[i];                                                   \
+    EXPECT_EQ_INT(v_sum(v, KEY, &sum), 0, #KEY " sum return code");                     \
+    EXPECT_TRUE(sum == expect_sum, #KEY " sum value");                                  \
+                                                                                        \
+    vec_destroy(v);                                                                     \
+}
+
+// Values are small integers so floating point sums are exact in any order
+CHECK_TYPE(int32_t, V_KEY_I32, int64_t, rand() % 2001 - 1000)
+CHECK_TYPE(int64_t, V_KEY_I64, int64_t, ((int64_t)(rand() % 2001 - 1000)) * 4000000000LL)
+CHECK_TYPE(float,   V_KEY_F32, double,  rand() % 2001 - 1000)
+CHECK_TYPE(double,  V_KEY_F64, double,  rand() % 2001 - 1000)
+
+// 1. Invalid input and type mismatches
+static void test_invalid_input(void) {
+    Vector *v = vec_create(4, sizeof(int32_t));
+    int32_t x = 1;
+    size_t idx;
+    int64_t sum;
+    uint64_t mask[1];
+
+    EXPECT_EQ_INT(v_find_value(NULL, V_KEY_I32, &x, &idx), -1, "find on NULL vector");
+    EXPECT_EQ_INT(v_find_value(v, V_KEY_I32, NULL, &idx), -1, "find without value");
+    EXPECT_EQ_INT(v_find_value(v, V_KEY_I64, &x, &idx), -1, "find with mismatched type");
+    EXPECT_EQ_INT(v_find_value(v, V_KEY_U32, &x, &idx), -1, "find with unsupported type");
+    EXPECT_EQ_INT(v_count_value(v, V_KEY_I32, &x, NULL), -1, "count without output");
+    EXPECT_EQ_INT(v_min_max(v, V_KEY_I32, NULL, NULL), -1, "min/max without outputs");
+    EXPECT_EQ_INT(v_sum(v, V_KEY_F64, &sum), -1, "sum with mismatched type");
+    EXPECT_EQ_INT(v_compare_mask(v, V_KEY_I32, (VecCmpOp)42, &x, mask), -1, "compare mask with bad op");
+
+    vec_destroy(v);
+}
+
+// 2. Every kernel at every supported level, over lengths that hit all tails
+static void test_kernels_all_levels(void) {
+    VecSimdLevel best = v_simd_set_level(V_SIMD_AVX512);
+    static const size_t sizes[] = { 0, 1, 3, 15, 16, 17, 63, 64, 65, 1000, 1023, 1024, 1025, 3000 };
+
+    for (int level = V_SIMD_SCALAR; level <= (int)best; level++) {
+        EXPECT_EQ_INT(v_simd_set_level((VecSimdLevel)level), (VecSimdLevel)level, "set level");
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            check_V_KEY_I32(sizes[s]);
+            check_V_KEY_I64(sizes[s]);
+            check_V_KEY_F32(sizes[s]);
+            check_V_KEY_F64(sizes[s]);
+        }
+    }
+
+    v_simd_set_level(best);
+}
+
+// 3. Throughput of the selected level against the scalar kernels
+static void test_timed_kernels(void) {
+    const size_t NUM_ELEMENTS = 16000000;
+    Vector *v = vec_create(NUM_ELEMENTS, sizeof(int32_t));
+    if (!v) {
+        fprintf(stderr, "[ERROR] Could not allocate vector for SIMD benchmark.\n");
+        return;
+    }
+    for (size_t i = 0; i < NUM_ELEMENTS; i++) {
+        int32_t x = rand();
+        v_push_back(v, &x);
+    }
+
+    VecSimdLevel best = v_simd_level();
+    VecSimdLevel levels[] = { V_SIMD_SCALAR, best };
+    for (int l = 0; l < 2; l++) {
+        v_simd_set_level(levels[l]);
+
+        struct timespec start, end;
+        int32_t probe = -1;
+        size_t count, imin, imax;
+        int64_t sum;
+        clock_gettime(1, &start);
+        v_count_value(v, V_KEY_I32, &probe, &count);
+        v_min_max(v, V_KEY_I32, &imin, &imax);
+        v_sum(v, V_KEY_I32, &sum);
+        clock_gettime(1, &end);
+
+        double elapsed_sec = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        printf("Level %d: count+min/max+sum over %zu int32 in %.3f seconds (%.2f GB/s)\n",
+               (int)levels[l], NUM_ELEMENTS, elapsed_sec,
+               3.0 * NUM_ELEMENTS * sizeof(int32_t) / elapsed_sec / 1e9);
+    }
+
+    v_simd_set_level(best);
+    vec_destroy(v);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    printf("Detected SIMD level: %d\n", (int)v_simd_level());
+
+    test_invalid_input();
+    test_kernels_all_levels();
+    test_timed_kernels();
+
+    printf("\n========== Test Summary ==========\n");
+    printf("Total tests run: %d\n", total_tests);
+    printf("Total failures : %d\n", failed_tests);
+    if (failed_tests == 0) {
+        printf("ALL TESTS PASSED\n");
+        return EXIT_SUCCESS;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return EXIT_FAILURE;
+    }
+}